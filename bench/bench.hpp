@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace oaknut::bench {
+
+// A benchmark body emits its workload `iterations` times and returns the total
+// number of instruction words emitted, which is what results are normalised by.
+using BenchmarkFunction = std::size_t (*)(std::size_t iterations);
+
+struct Benchmark {
+    std::string name;
+    BenchmarkFunction fn;
+};
+
+inline std::vector<Benchmark>& registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+inline bool register_benchmark(std::string name, BenchmarkFunction fn)
+{
+    registry().push_back(Benchmark{std::move(name), fn});
+    return true;
+}
+
+// Prevents the optimiser from discarding emitted code.
+inline void consume(std::uint32_t value)
+{
+    static volatile std::uint32_t sink;
+    sink = sink ^ value;
+}
+
+// Hides value from the optimiser, so that a loop computing operands from it is not vectorised.
+template<typename T>
+inline void opaque(T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+r"(value));
+#else
+    (void)value;
+#endif
+}
+
+// Each code unit a benchmark emits in one iteration is at most this many words.
+inline constexpr std::size_t unit_capacity = 1 << 16;
+
+}  // namespace oaknut::bench
+
+#define OAKNUT_BENCH_CONCAT_IMPL(a, b) a##b
+#define OAKNUT_BENCH_CONCAT(a, b) OAKNUT_BENCH_CONCAT_IMPL(a, b)
+#define OAKNUT_BENCHMARK(name, fn) \
+    static const bool OAKNUT_BENCH_CONCAT(oaknut_benchmark_, __LINE__) = ::oaknut::bench::register_benchmark(name, fn)
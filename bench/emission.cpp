@@ -0,0 +1,399 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+#include "oaknut/oaknut.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+namespace {
+
+template<typename Mix>
+std::size_t run_pointer(std::size_t iterations)
+{
+    static std::vector<std::uint32_t> buffer(bench::unit_capacity);
+
+    // The generator is long-lived, as in a JIT; each iteration rewinds it to the start of the buffer.
+    CodeGenerator code{buffer.data()};
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < iterations; i++) {
+        code.set_offset(0);
+        Mix::emit(code);
+        const std::size_t count = code.offset() / sizeof(std::uint32_t);
+        bench::consume(buffer[count - 1]);
+        total += count;
+    }
+    return total;
+}
+
+template<typename Mix>
+std::size_t run_bounded(std::size_t iterations)
+{
+    static std::vector<std::uint32_t> buffer(bench::unit_capacity);
+
+    BoundedCodeGenerator code{buffer.data(), buffer.size()};
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < iterations; i++) {
+        code.set_offset(0);
+        Mix::emit(code);
+        const std::size_t count = code.offset() / sizeof(std::uint32_t);
+        bench::consume(buffer[count - 1]);
+        total += count;
+    }
+    return total;
+}
+
+template<typename Mix>
+std::size_t run_vector(std::size_t iterations)
+{
+    std::vector<std::uint32_t> vec;
+    vec.reserve(bench::unit_capacity);
+
+    VectorCodeGenerator code{vec};
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < iterations; i++) {
+        vec.clear();
+        Mix::emit(code);
+        bench::consume(vec.back());
+        total += vec.size();
+    }
+    return total;
+}
+
+// Large units are emitted into fresh storage and then copied to their final location, as for a translated block.
+template<typename Mix>
+std::size_t run_vector_large(std::size_t iterations)
+{
+    static std::vector<std::uint32_t> destination(Mix::capacity);
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < iterations; i++) {
+        std::vector<std::uint32_t> vec;
+        VectorCodeGenerator code{vec};
+        Mix::emit(code);
+        std::copy(vec.begin(), vec.end(), destination.begin());
+        bench::consume(destination[vec.size() - 1]);
+        total += vec.size();
+    }
+    return total;
+}
+
+template<typename Mix>
+std::size_t run_segmented_large(std::size_t iterations)
+{
+    static std::vector<std::uint32_t> destination(Mix::capacity);
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < iterations; i++) {
+        SegmentedBuffer<> buffer;
+        SegmentedCodeGenerator code{buffer};
+        Mix::emit(code);
+        buffer.copy_to(destination.data());
+        bench::consume(destination[buffer.size() - 1]);
+        total += buffer.size();
+    }
+    return total;
+}
+
+// Fixed sequences encoded at compile time are placed with memcpy instead of being emitted.
+template<typename Mix>
+std::size_t run_assembled(std::size_t iterations)
+{
+    static constexpr auto words = assemble<Mix::size>(Mix::template emit_one<ArrayCodeGenerator<Mix::size>>);
+    static std::vector<std::uint32_t> buffer(bench::unit_capacity);
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < iterations; i++) {
+        std::uint32_t* ptr = buffer.data();
+        for (std::size_t j = 0; j < Mix::count; j++, ptr += words.size())
+            std::memcpy(ptr, words.data(), sizeof(words));
+        bench::consume(ptr[-1]);
+        total += Mix::count * words.size();
+    }
+    return total;
+}
+
+struct AluMix {
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (int i = 0; i < 256; i++) {
+            const XReg xd{i % 29}, xn{(i + 7) % 29}, xm{(i + 13) % 29};
+            const WReg wd{i % 29}, wn{(i + 3) % 29}, wm{(i + 11) % 29};
+
+            code.ADD(xd, xn, xm);
+            code.ADD(xd, xn, i & 0xFFF);
+            code.SUB(wd, wn, wm, LSL, i & 31);
+            code.SUBS(xd, xn, (i * 3) & 0xFFF);
+            code.AND(xd, xn, xm);
+            code.AND(wd, wn, 0xFF);
+            code.ORR(xd, xn, xm, LSR, i & 63);
+            code.EOR(wd, wn, wm);
+            code.LSL(xd, xn, i & 63);
+            code.ASR(wd, wn, i & 31);
+            code.MADD(xd, xn, xm, XReg{(i + 5) % 29});
+            code.CMP(xn, xm);
+            code.CSEL(wd, wn, wm, static_cast<Cond>(i & 13));
+            code.MOV(xd, xm);
+            code.LDR(xd, SP, (i & 0xFF) * 8);
+            code.STP(xn, xm, SP, (i & 31) * 16);
+        }
+    }
+};
+
+struct MovImm64Mix {
+    static const std::array<std::uint64_t, 1024>& values()
+    {
+        static const std::array<std::uint64_t, 1024> table = [] {
+            std::array<std::uint64_t, 1024> result{};
+            std::mt19937_64 rng{0x6f616b6e7574};
+            for (std::size_t i = 0; i < result.size(); i++) {
+                const std::uint64_t r = rng();
+                switch (i % 8) {
+                case 0:  // small positive
+                    result[i] = r & 0xFFFF;
+                    break;
+                case 1:  // small negative
+                    result[i] = ~(r & 0xFFFF);
+                    break;
+                case 2:  // bitmask immediate
+                    result[i] = 0x00FF00FF00FF00FF << (r & 7);
+                    break;
+                case 3:  // 32-bit value
+                    result[i] = r & 0xFFFFFFFF;
+                    break;
+                case 4:  // pointer-like
+                    result[i] = 0x0000'7F00'0000'0000 | (r & 0xFF'FFFF'FFF0);
+                    break;
+                case 5:  // mostly ones
+                    result[i] = r | 0xFFFF'0000'FFFF'0000;
+                    break;
+                default:  // arbitrary
+                    result[i] = r;
+                    break;
+                }
+            }
+            return result;
+        }();
+        return table;
+    }
+
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        const auto& table = values();
+        for (std::size_t i = 0; i < table.size(); i++) {
+            code.MOV(XReg{static_cast<int>(i % 29)}, table[i]);
+        }
+    }
+};
+
+struct LiteralPoolMix {
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        const auto& table = MovImm64Mix::values();
+        for (std::size_t i = 0; i < table.size(); i++) {
+            code.LDR(XReg{static_cast<int>(i % 29)}, code.literal64(table[i]));
+        }
+        code.RET();
+        code.flush_literals();
+    }
+};
+
+struct ForwardLabelMix {
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        Label head;
+        code.l(head);
+        for (int i = 0; i < 512; i++) {
+            const XReg x{i % 29};
+            Label skip, out;
+
+            code.CBZ(x, skip);
+            code.B(NE, out);
+            code.ADD(x, x, 1);
+            code.TBNZ(x, i & 63, out);
+            code.l(skip);
+            code.SUB(x, x, 1);
+            code.l(out);
+            if ((i & 15) == 15)
+                code.B(LT, head);
+        }
+    }
+};
+
+struct LabelFanoutMix {
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (int i = 0; i < 64; i++) {
+            Label exit;
+            for (int j = 0; j < 16; j++) {
+                code.CMP(XReg{j}, i);
+                code.B(EQ, exit);
+            }
+            code.B(exit);
+            code.l(exit);
+        }
+    }
+};
+
+struct FpsimdMix {
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (int i = 0; i < 256; i++) {
+            const int d = i % 32, n = (i + 9) % 32, m = (i + 17) % 32;
+
+            code.FADD(VReg_4S{d}, VReg_4S{n}, VReg_4S{m});
+            code.FMUL(VReg_2D{d}, VReg_2D{n}, VReg_2D{m});
+            code.FMLA(VReg_4S{d}, VReg_4S{n}, SElem{m & 15, static_cast<unsigned>(i & 3)});
+            code.FMLA(VReg_2D{d}, VReg_2D{n}, VReg_2D{m});
+            code.FADD(DReg{d}, DReg{n}, DReg{m});
+            code.FMUL(SReg{d}, SReg{n}, SReg{m});
+            code.EOR(VReg_16B{d}, VReg_16B{n}, VReg_16B{m});
+            code.ZIP1(VReg_8H{d}, VReg_8H{n}, VReg_8H{m});
+            code.DUP(VReg_4S{d}, WReg{n % 29});
+            code.DUP(VReg_2D{d}, DElem{n, static_cast<unsigned>(i & 1)});
+            code.FCVTZS(VReg_4S{d}, VReg_4S{n});
+            code.SCVTF(DReg{d}, XReg{n % 29});
+            code.LDR(QReg{d}, XReg{n % 29}, (i & 0xFF) * 16);
+            code.STR(QReg{m}, SP, (i & 0x7F) * 16);
+            code.LD1(List{VReg_16B{d}}, XReg{m % 29});
+            code.FMOV(DReg{d}, FImm8{static_cast<std::uint8_t>(i)});
+        }
+    }
+};
+
+// A fixed call stub, as used for exits from translated code.
+struct StubMix {
+    static constexpr std::size_t size = 15;
+    static constexpr std::size_t count = 256;
+
+    template<typename CodeGen>
+    static constexpr void emit_one(CodeGen& code)
+    {
+        Label slow;
+        code.STP(X29, X30, SP, PRE_INDEXED, -32);
+        code.MOV(X29, SP);
+        code.STR(X19, SP, 16);
+        code.MOV(X19, X0);
+        code.LDR(X8, X0, 8);
+        code.CBZ(X8, slow);
+        code.MOV(X0, X1);
+        code.BLR(X8);
+        code.LDR(X19, SP, 16);
+        code.LDP(X29, X30, SP, POST_INDEXED, 32);
+        code.RET();
+        code.l(slow);
+        code.MOV(X0, 0x0000'7f12'3456'7000);
+        code.BR(X1);
+    }
+
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            emit_one(code);
+    }
+};
+
+// A template JIT's instruction shape, differing only in registers and immediates.
+struct ShapeMix {
+    static constexpr std::size_t count = 1024;
+
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (std::size_t i = 0; i < count; i++) {
+            const XReg a{static_cast<int>(i % 29)}, b{static_cast<int>((i + 11) % 29)};
+            const auto imm = static_cast<std::uint32_t>(i * 8) & 0xFFF;
+
+            code.ADD(a, b, imm);
+            code.LDR(b, a, 8);
+            code.ADD(a, a, b, LSL, 3);
+            code.STR(a, X28, (i & 0x1FF) * 8);
+        }
+    }
+};
+
+// ShapeMix, emitted as a stencil.
+struct ShapeStencilMix {
+    static constexpr auto shape = make_stencil<4>(
+        [](auto& code) {
+            code.ADD(X0, X0, 0);
+            code.LDR(X0, X0, 8);
+            code.ADD(X0, X0, X0, LSL, 3);
+            code.STR(X0, X28, 0);
+        },
+        StencilHole{0, stencil::Rd}, StencilHole{0, stencil::Rn}, StencilHole{0, stencil::Imm12},
+        StencilHole{1, stencil::Rt}, StencilHole{1, stencil::Rn},
+        StencilHole{2, stencil::Rd}, StencilHole{2, stencil::Rn}, StencilHole{2, stencil::Rm},
+        StencilHole{3, stencil::Rt}, StencilHole{3, stencil::Imm12});
+
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (std::size_t i = 0; i < ShapeMix::count; i++) {
+            const XReg a{static_cast<int>(i % 29)}, b{static_cast<int>((i + 11) % 29)};
+            const auto imm = static_cast<std::uint32_t>(i * 8) & 0xFFF;
+
+            code.template emit_stencil<shape>({a, b, imm, b, a, a, a, b, a, static_cast<std::uint32_t>(i & 0x1FF)});
+        }
+    }
+};
+
+// 4 MiB of code in a single unit.
+struct LargeBlockMix {
+    static constexpr std::size_t capacity = 256 * 256 * 16;
+
+    template<typename CodeGen>
+    static void emit(CodeGen& code)
+    {
+        for (int i = 0; i < 256; i++)
+            AluMix::emit(code);
+    }
+};
+
+}  // namespace
+
+OAKNUT_BENCHMARK("alu/CodeGenerator", run_pointer<AluMix>);
+OAKNUT_BENCHMARK("alu/BoundedCodeGenerator", run_bounded<AluMix>);
+OAKNUT_BENCHMARK("alu/VectorCodeGenerator", run_vector<AluMix>);
+OAKNUT_BENCHMARK("mov_imm64/CodeGenerator", run_pointer<MovImm64Mix>);
+OAKNUT_BENCHMARK("mov_imm64/BoundedCodeGenerator", run_bounded<MovImm64Mix>);
+OAKNUT_BENCHMARK("mov_imm64/VectorCodeGenerator", run_vector<MovImm64Mix>);
+OAKNUT_BENCHMARK("literal_pool/CodeGenerator", run_pointer<LiteralPoolMix>);
+OAKNUT_BENCHMARK("literal_pool/BoundedCodeGenerator", run_bounded<LiteralPoolMix>);
+OAKNUT_BENCHMARK("literal_pool/VectorCodeGenerator", run_vector<LiteralPoolMix>);
+OAKNUT_BENCHMARK("forward_labels/CodeGenerator", run_pointer<ForwardLabelMix>);
+OAKNUT_BENCHMARK("forward_labels/BoundedCodeGenerator", run_bounded<ForwardLabelMix>);
+OAKNUT_BENCHMARK("forward_labels/VectorCodeGenerator", run_vector<ForwardLabelMix>);
+OAKNUT_BENCHMARK("label_fanout/CodeGenerator", run_pointer<LabelFanoutMix>);
+OAKNUT_BENCHMARK("label_fanout/BoundedCodeGenerator", run_bounded<LabelFanoutMix>);
+OAKNUT_BENCHMARK("label_fanout/VectorCodeGenerator", run_vector<LabelFanoutMix>);
+OAKNUT_BENCHMARK("fpsimd/CodeGenerator", run_pointer<FpsimdMix>);
+OAKNUT_BENCHMARK("fpsimd/BoundedCodeGenerator", run_bounded<FpsimdMix>);
+OAKNUT_BENCHMARK("fpsimd/VectorCodeGenerator", run_vector<FpsimdMix>);
+OAKNUT_BENCHMARK("stub/CodeGenerator", run_pointer<StubMix>);
+OAKNUT_BENCHMARK("stub/assemble", run_assembled<StubMix>);
+OAKNUT_BENCHMARK("shape/CodeGenerator", run_pointer<ShapeMix>);
+OAKNUT_BENCHMARK("shape/CodeGenerator (stencil)", run_pointer<ShapeStencilMix>);
+OAKNUT_BENCHMARK("shape/VectorCodeGenerator", run_vector<ShapeMix>);
+OAKNUT_BENCHMARK("shape/VectorCodeGenerator (stencil)", run_vector<ShapeStencilMix>);
+OAKNUT_BENCHMARK("large_block/VectorCodeGenerator", run_vector_large<LargeBlockMix>);
+OAKNUT_BENCHMARK("large_block/SegmentedCodeGenerator", run_segmented_large<LargeBlockMix>);
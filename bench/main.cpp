@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+
+namespace {
+
+struct Options {
+    std::string filter;
+    double min_time = 0.2;
+    std::size_t repetitions = 5;
+    bool csv = false;
+};
+
+struct Result {
+    std::string name;
+    std::size_t iterations;
+    std::size_t instructions;
+    double ns_per_instruction_median;
+    double ns_per_instruction_min;
+};
+
+void usage(const char* argv0)
+{
+    std::fprintf(stderr,
+                 "usage: %s [--filter=SUBSTRING] [--min-time=SECONDS] [--repetitions=N] [--format=json|csv]\n",
+                 argv0);
+}
+
+bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            options.filter = arg + 9;
+        } else if (std::strncmp(arg, "--min-time=", 11) == 0) {
+            options.min_time = std::atof(arg + 11);
+        } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            options.repetitions = std::max<std::size_t>(1, std::strtoull(arg + 14, nullptr, 10));
+        } else if (std::strcmp(arg, "--format=json") == 0) {
+            options.csv = false;
+        } else if (std::strcmp(arg, "--format=csv") == 0) {
+            options.csv = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+double time_run(oaknut::bench::BenchmarkFunction fn, std::size_t iterations, std::size_t& instructions)
+{
+    const auto start = std::chrono::steady_clock::now();
+    instructions = fn(iterations);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+Result measure(const oaknut::bench::Benchmark& benchmark, const Options& options)
+{
+    std::size_t instructions = 0;
+
+    // Warm up, then grow the iteration count until one repetition takes at least min_time.
+    time_run(benchmark.fn, 1, instructions);
+    std::size_t iterations = 1;
+    for (;;) {
+        const double ns = time_run(benchmark.fn, iterations, instructions);
+        if (ns >= options.min_time * 1e9 || iterations >= (std::size_t{1} << 30))
+            break;
+        const double scale = ns > 0 ? (options.min_time * 1e9) / ns : 10.0;
+        iterations = std::max(iterations + 1, static_cast<std::size_t>(static_cast<double>(iterations) * std::min(scale * 1.2, 10.0)));
+    }
+
+    std::vector<double> samples;
+    for (std::size_t r = 0; r < options.repetitions; r++) {
+        const double ns = time_run(benchmark.fn, iterations, instructions);
+        samples.push_back(ns / static_cast<double>(instructions));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    return Result{
+        benchmark.name,
+        iterations,
+        instructions,
+        samples[samples.size() / 2],
+        samples.front(),
+    };
+}
+
+void print_json(const std::vector<Result>& results, const Options& options)
+{
+    std::printf("{\n  \"min_time\": %g,\n  \"repetitions\": %zu,\n  \"benchmarks\": [", options.min_time, options.repetitions);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        std::printf("%s\n    {\"name\": \"%s\", \"iterations\": %zu, \"instructions\": %zu, "
+                    "\"ns_per_instruction\": %.4f, \"ns_per_instruction_min\": %.4f, \"instructions_per_second\": %.0f}",
+                    i == 0 ? "" : ",",
+                    r.name.c_str(), r.iterations, r.instructions,
+                    r.ns_per_instruction_median, r.ns_per_instruction_min, 1e9 / r.ns_per_instruction_median);
+    }
+    std::printf("\n  ]\n}\n");
+}
+
+void print_csv(const std::vector<Result>& results)
+{
+    std::printf("name,iterations,instructions,ns_per_instruction,ns_per_instruction_min,instructions_per_second\n");
+    for (const Result& r : results) {
+        std::printf("%s,%zu,%zu,%.4f,%.4f,%.0f\n",
+                    r.name.c_str(), r.iterations, r.instructions,
+                    r.ns_per_instruction_median, r.ns_per_instruction_min, 1e9 / r.ns_per_instruction_median);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (const auto& benchmark : oaknut::bench::registry()) {
+        if (benchmark.name.find(options.filter) == std::string::npos)
+            continue;
+        results.push_back(measure(benchmark, options));
+        std::fprintf(stderr, "%-48s %8.3f ns/insn\n", benchmark.name.c_str(), results.back().ns_per_instruction_median);
+    }
+
+    if (options.csv) {
+        print_csv(results);
+    } else {
+        print_json(results, options);
+    }
+
+    return 0;
+}
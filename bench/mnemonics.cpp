@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bench.hpp"
+#include "oaknut/oaknut.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+// Each mnemonic is emitted through CodeGenerator and, for comparison, encoded by hand with no operand checks.
+// Operands vary with the index i, which is opaque to the optimiser, so that both loops are scalar. Label operands refer back to the
+// start of the unit, and pointer operands to the start of the buffer.
+
+namespace {
+
+constexpr std::size_t unit_size = 4096;
+
+std::vector<std::uint32_t>& buffer()
+{
+    static std::vector<std::uint32_t> words(unit_size);
+    return words;
+}
+
+template<typename Op>
+std::size_t run_emit(std::size_t iterations)
+{
+    std::uint32_t* const mem = buffer().data();
+    CodeGenerator code{mem};
+
+    for (std::size_t n = 0; n < iterations; n++) {
+        code.set_offset(0);
+        Label head = code.l();
+        for (std::uint32_t i = 0; i < unit_size; i++) {
+            bench::opaque(i);
+            Op::emit(code, i, head, mem);
+        }
+        bench::consume(mem[unit_size - 1]);
+    }
+    return iterations * unit_size;
+}
+
+// Hand-encoded words are appended with dw(), so that only the cost of encoding differs.
+template<typename Op>
+std::size_t run_manual(std::size_t iterations)
+{
+    std::uint32_t* const mem = buffer().data();
+    CodeGenerator code{mem};
+
+    for (std::size_t n = 0; n < iterations; n++) {
+        code.set_offset(0);
+        for (std::uint32_t i = 0; i < unit_size; i++) {
+            bench::opaque(i);
+            code.dw(Op::encode(i, code.offset(), mem));
+        }
+        bench::consume(mem[unit_size - 1]);
+    }
+    return iterations * unit_size;
+}
+
+struct AddShiftedOp {
+    static void emit(CodeGenerator& code, std::uint32_t i, Label&, const void*)
+    {
+        code.ADD(XReg(i % 31), XReg((i + 5) % 31), XReg((i + 9) % 31), LSL, i & 63);
+    }
+
+    static std::uint32_t encode(std::uint32_t i, std::ptrdiff_t, const void*)
+    {
+        return 0x8b00'0000 | ((i + 9) % 31) << 16 | (i & 63) << 10 | ((i + 5) % 31) << 5 | (i % 31);
+    }
+};
+
+struct AddImmOp {
+    static void emit(CodeGenerator& code, std::uint32_t i, Label&, const void*)
+    {
+        code.ADD(XReg(i % 31), XReg((i + 5) % 31), i & 0xFFF);
+    }
+
+    static std::uint32_t encode(std::uint32_t i, std::ptrdiff_t, const void*)
+    {
+        return 0x9100'0000 | (i & 0xFFF) << 10 | ((i + 5) % 31) << 5 | (i % 31);
+    }
+};
+
+struct LdrImmOp {
+    static void emit(CodeGenerator& code, std::uint32_t i, Label&, const void*)
+    {
+        code.LDR(XReg(i % 31), XReg((i + 5) % 31), (i & 0xFFF) * 8);
+    }
+
+    static std::uint32_t encode(std::uint32_t i, std::ptrdiff_t, const void*)
+    {
+        return 0xf940'0000 | (i & 0xFFF) << 10 | ((i + 5) % 31) << 5 | (i % 31);
+    }
+};
+
+struct MovzOp {
+    static void emit(CodeGenerator& code, std::uint32_t i, Label&, const void*)
+    {
+        code.MOVZ(XReg(i % 31), MovImm16{static_cast<std::uint16_t>(i * 7), static_cast<MovImm16Shift>(i & 3)});
+    }
+
+    static std::uint32_t encode(std::uint32_t i, std::ptrdiff_t, const void*)
+    {
+        return 0xd280'0000 | (i & 3) << 21 | (i * 7 & 0xFFFF) << 5 | (i % 31);
+    }
+};
+
+struct BLabelOp {
+    static void emit(CodeGenerator& code, std::uint32_t, Label& head, const void*)
+    {
+        code.B(head);
+    }
+
+    static std::uint32_t encode(std::uint32_t, std::ptrdiff_t offset, const void*)
+    {
+        return 0x1400'0000 | static_cast<std::uint32_t>((-offset >> 2) & 0x03FF'FFFF);
+    }
+};
+
+struct CbzLabelOp {
+    static void emit(CodeGenerator& code, std::uint32_t i, Label& head, const void*)
+    {
+        code.CBZ(XReg(i % 31), head);
+    }
+
+    static std::uint32_t encode(std::uint32_t i, std::ptrdiff_t offset, const void*)
+    {
+        return 0xb400'0000 | static_cast<std::uint32_t>((-offset >> 2) & 0x7'FFFF) << 5 | (i % 31);
+    }
+};
+
+struct AdrPointerOp {
+    static void emit(CodeGenerator& code, std::uint32_t i, Label&, const void* target)
+    {
+        code.ADR(XReg(i % 31), target);
+    }
+
+    static std::uint32_t encode(std::uint32_t i, std::ptrdiff_t offset, const void*)
+    {
+        const auto diff = static_cast<std::uint32_t>(-offset);
+        return 0x1000'0000 | (diff & 3) << 29 | ((diff >> 2) & 0x7'FFFF) << 5 | (i % 31);
+    }
+};
+
+}  // namespace
+
+OAKNUT_BENCHMARK("mnemonic/ADD (shifted register)", run_emit<AddShiftedOp>);
+OAKNUT_BENCHMARK("mnemonic/ADD (shifted register) [manual]", run_manual<AddShiftedOp>);
+OAKNUT_BENCHMARK("mnemonic/ADD (immediate)", run_emit<AddImmOp>);
+OAKNUT_BENCHMARK("mnemonic/ADD (immediate) [manual]", run_manual<AddImmOp>);
+OAKNUT_BENCHMARK("mnemonic/LDR (immediate)", run_emit<LdrImmOp>);
+OAKNUT_BENCHMARK("mnemonic/LDR (immediate) [manual]", run_manual<LdrImmOp>);
+OAKNUT_BENCHMARK("mnemonic/MOVZ", run_emit<MovzOp>);
+OAKNUT_BENCHMARK("mnemonic/MOVZ [manual]", run_manual<MovzOp>);
+OAKNUT_BENCHMARK("mnemonic/B (label)", run_emit<BLabelOp>);
+OAKNUT_BENCHMARK("mnemonic/B (label) [manual]", run_manual<BLabelOp>);
+OAKNUT_BENCHMARK("mnemonic/CBZ (label)", run_emit<CbzLabelOp>);
+OAKNUT_BENCHMARK("mnemonic/CBZ (label) [manual]", run_manual<CbzLabelOp>);
+OAKNUT_BENCHMARK("mnemonic/ADR (pointer)", run_emit<AdrPointerOp>);
+OAKNUT_BENCHMARK("mnemonic/ADR (pointer) [manual]", run_manual<AdrPointerOp>);
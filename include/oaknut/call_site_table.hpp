@@ -0,0 +1,294 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "oaknut/impl/patch.hpp"
+#include "oaknut/oaknut.hpp"
+
+namespace oaknut {
+
+// Lazily bound call and jump sites in code held by a Block (CodeBlock or DualCodeBlock).
+//
+// Each site is a B or BL to a veneer of its own:
+//
+//     veneer: ADR X17, slot
+//             LDR X16, [X17]
+//             BR X16
+//             NOP
+//     slot:   .quad target      (initially the resolver)
+//             .quad site index
+//
+// The first time a site is reached, the resolver calls the compile callback with the site's key and links the site
+// to the returned target: a target within range of B/BL is branched to directly, and a farther one is stored in the
+// veneer's slot. Either way the site is rewritten by a single atomic store, so other threads may be executing it.
+// unlink() returns the sites branching to a target to the resolver, for example when the target is evicted.
+//
+// Veneers clobber X16 and X17, as permitted for veneers by the procedure call standard.
+// The table is guarded by a recursive mutex, which the resolver holds while compiling and linking a site, so sites may
+// be reached concurrently and the compile callback may itself emit sites, link and unlink. A site already linked by
+// another thread by the time the resolver holds the mutex is not compiled again. The generators sites and veneers are
+// emitted with are not guarded, as usual.
+template<typename Block>
+class CallSiteTable {
+public:
+    // Returns the executable address of the code for key. Called from the resolver with the table's mutex held, so it
+    // must not throw.
+    using CompileCallback = std::function<const void*(std::uint64_t key)>;
+
+    CallSiteTable(Block& block, CompileCallback compile)
+        : m_block(block), m_compile(std::move(compile))
+    {}
+
+    CallSiteTable(const CallSiteTable&) = delete;
+    CallSiteTable& operator=(const CallSiteTable&) = delete;
+    CallSiteTable(CallSiteTable&&) = delete;
+    CallSiteTable& operator=(CallSiteTable&&) = delete;
+
+    // Emits the resolver shared by all sites of this table. It must be emitted before the first veneer.
+    // The resolver preserves the argument registers (X0-X8, Q0-Q7) and LR, so the site's target receives the
+    // original arguments and returns to the site's caller.
+    template<typename Policy>
+    void emit_resolver(BasicCodeGenerator<Policy>& code)
+    {
+        using namespace util;
+
+        m_resolver = code.template xptr<const void*>();
+
+        code.STP(X29, X30, SP, PRE_INDEXED, -224);
+        code.MOV(X29, SP);
+        code.STP(X0, X1, SP, 16);
+        code.STP(X2, X3, SP, 32);
+        code.STP(X4, X5, SP, 48);
+        code.STP(X6, X7, SP, 64);
+        code.STR(X8, SP, 80);
+        code.STP(Q0, Q1, SP, 96);
+        code.STP(Q2, Q3, SP, 128);
+        code.STP(Q4, Q5, SP, 160);
+        code.STP(Q6, Q7, SP, 192);
+
+        code.LDR(X1, X17, 8);
+        code.MOVP2R(X0, this);
+        code.MOVP2R(X16, reinterpret_cast<const void*>(&CallSiteTable::resolve));
+        code.BLR(X16);
+        code.MOV(X16, X0);
+
+        code.LDP(Q6, Q7, SP, 192);
+        code.LDP(Q4, Q5, SP, 160);
+        code.LDP(Q2, Q3, SP, 128);
+        code.LDP(Q0, Q1, SP, 96);
+        code.LDR(X8, SP, 80);
+        code.LDP(X6, X7, SP, 64);
+        code.LDP(X4, X5, SP, 48);
+        code.LDP(X2, X3, SP, 32);
+        code.LDP(X0, X1, SP, 16);
+        code.LDP(X29, X30, SP, POST_INDEXED, 224);
+        code.BR(X16);
+    }
+
+    // Emits a BL to the code for key and returns the index of the new site.
+    template<typename Policy>
+    std::size_t emit_call(BasicCodeGenerator<Policy>& code, std::uint64_t key)
+    {
+        return emit_site(code, key, true);
+    }
+
+    // Emits a B to the code for key (a tail call, or a jump to another block) and returns the index of the new site.
+    template<typename Policy>
+    std::size_t emit_jump(BasicCodeGenerator<Policy>& code, std::uint64_t key)
+    {
+        return emit_site(code, key, false);
+    }
+
+    // Emits the veneers of the sites emitted since the last call, at the current position. Execution must not fall
+    // through into them. code must be the generator the sites were emitted with, and each site must be within
+    // range of B/BL (±128 MiB) of its veneer.
+    template<typename Policy>
+    void emit_veneers(BasicCodeGenerator<Policy>& code)
+    {
+        using namespace util;
+
+        const std::lock_guard lock{m_mutex};
+
+        if (m_pending.empty())
+            return;
+        if (m_resolver == nullptr)
+            return detail::report_error(ExceptionType::ResolverNotEmitted);
+
+        for (Pending& pending : m_pending) {
+            // The resolver finds the site index next to the slot, so no island may be emitted within a veneer.
+            code.reserve_contiguous(sizeof(std::uint32_t) + veneer_size);
+            code.align(8);
+            code.l(pending.label);
+            Site& site = m_sites[pending.site];
+            site.veneer = code.template xptr<std::uint32_t*>();
+
+            Label slot;
+            code.ADR(X17, slot);
+            code.LDR(X16, X17);
+            code.BR(X16);
+            code.NOP();
+            code.l(slot);
+            site.slot = code.template xptr<std::uint64_t*>();
+            code.dx(reinterpret_cast<std::uintptr_t>(m_resolver));
+            code.dx(pending.site);
+        }
+        m_pending.clear();
+    }
+
+    // Links site to target, which must already be executable. A site that is already linked is relinked.
+    // The site's veneer must have been emitted.
+    void link(std::size_t site_index, const void* target)
+    {
+        const std::lock_guard lock{m_mutex};
+        link_site(site_index, target);
+    }
+
+    // Returns every site linked to target to the resolver, with one round of cache maintenance.
+    void unlink(const void* target)
+    {
+        const std::lock_guard lock{m_mutex};
+
+        const auto iter = m_incoming.find(target);
+        if (iter == m_incoming.end())
+            return;
+
+        std::vector<PatchSite> patches;
+        for (const std::size_t site_index : iter->second) {
+            Site& site = m_sites[site_index];
+            m_block.patch_literal(site.slot, reinterpret_cast<std::uintptr_t>(m_resolver));
+            if (site.direct)
+                patches.push_back({site.instruction, encode_site(site, site.veneer)});
+            site.target = nullptr;
+            site.direct = false;
+        }
+        m_incoming.erase(iter);
+
+        if (!patches.empty())
+            m_block.patch(patches);
+    }
+
+    std::uint64_t key(std::size_t site_index) const
+    {
+        const std::lock_guard lock{m_mutex};
+        return m_sites[site_index].key;
+    }
+
+    // Target site is linked to, or nullptr.
+    const void* target(std::size_t site_index) const
+    {
+        const std::lock_guard lock{m_mutex};
+        return m_sites[site_index].target;
+    }
+
+    std::size_t size() const
+    {
+        const std::lock_guard lock{m_mutex};
+        return m_sites.size();
+    }
+
+private:
+    struct Site {
+        std::uint32_t* instruction;  // executable address of the B or BL
+        std::uint32_t* veneer = nullptr;
+        std::uint64_t* slot = nullptr;  // executable address of the veneer's target
+        std::uint64_t key;
+        const void* target = nullptr;
+        bool is_call;
+        bool direct = false;  // whether the instruction branches to target rather than to the veneer
+    };
+
+    struct Pending {
+        Label label;
+        std::size_t site;
+    };
+
+    // Size of a veneer, including its slot and site index.
+    static constexpr std::size_t veneer_size = 4 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t);
+
+    void link_site(std::size_t site_index, const void* target)
+    {
+        Site& site = m_sites[site_index];
+        if (site.target == target)
+            return;
+        if (site.target != nullptr)
+            forget_incoming(site_index);
+
+        site.target = target;
+        m_incoming[target].push_back(site_index);
+
+        // The slot is updated first, so that a thread reaching the veneer through the old instruction also arrives
+        // at the new target.
+        m_block.patch_literal(site.slot, reinterpret_cast<std::uintptr_t>(target));
+
+        const bool direct = in_branch_range(site.instruction, target);
+        if (direct || site.direct)
+            m_block.patch(site.instruction, encode_site(site, direct ? target : site.veneer));
+        site.direct = direct;
+    }
+
+    template<typename Policy>
+    std::size_t emit_site(BasicCodeGenerator<Policy>& code, std::uint64_t key, bool is_call)
+    {
+        const std::lock_guard lock{m_mutex};
+
+        // An island due here is emitted first, so that the recorded address is that of the site.
+        code.reserve_contiguous(sizeof(std::uint32_t));
+        const std::size_t site_index = m_sites.size();
+        m_sites.push_back(Site{code.template xptr<std::uint32_t*>(), nullptr, nullptr, key, nullptr, is_call, false});
+        m_pending.push_back(Pending{Label{}, site_index});
+
+        Label& veneer = m_pending.back().label;
+        is_call ? code.BL(veneer) : code.B(veneer);
+        return site_index;
+    }
+
+    static bool in_branch_range(const std::uint32_t* from, const void* to)
+    {
+        const std::ptrdiff_t diff = reinterpret_cast<std::intptr_t>(to) - reinterpret_cast<std::intptr_t>(from);
+        return diff >= -(std::ptrdiff_t{1} << 27) && diff < (std::ptrdiff_t{1} << 27) && (diff & 3) == 0;
+    }
+
+    static std::uint32_t encode_site(const Site& site, const void* target)
+    {
+        return site.is_call ? encode_bl(site.instruction, target) : encode_b(site.instruction, target);
+    }
+
+    void forget_incoming(std::size_t site_index)
+    {
+        Site& site = m_sites[site_index];
+        std::vector<std::size_t>& incoming = m_incoming[site.target];
+        std::erase(incoming, site_index);
+        if (incoming.empty())
+            m_incoming.erase(site.target);
+    }
+
+    static const void* resolve(CallSiteTable* table, std::size_t site_index)
+    {
+        const std::lock_guard lock{table->m_mutex};
+
+        if (const void* target = table->m_sites[site_index].target)
+            return target;
+        const void* target = table->m_compile(table->m_sites[site_index].key);
+        table->link_site(site_index, target);
+        return target;
+    }
+
+    Block& m_block;
+    CompileCallback m_compile;
+    const void* m_resolver = nullptr;
+    std::vector<Site> m_sites;
+    std::vector<Pending> m_pending;
+    std::unordered_map<const void*, std::vector<std::size_t>> m_incoming;
+    mutable std::recursive_mutex m_mutex;
+};
+
+}  // namespace oaknut
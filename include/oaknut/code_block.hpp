@@ -3,17 +3,17 @@
 
 #pragma once
 
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <new>
+#include <span>
 
 #if defined(_WIN32)
-#    define NOMINMAX
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
 #    include <windows.h>
 #elif defined(__APPLE__)
 #    include <TargetConditionals.h>
-#    include <libkern/OSCacheControl.h>
 #    include <pthread.h>
 #    include <sys/mman.h>
 #    include <unistd.h>
@@ -21,31 +21,34 @@
 #    include <sys/mman.h>
 #endif
 
+#include "oaknut/impl/cache_maintenance.hpp"
+#include "oaknut/impl/code_block_options.hpp"
+#include "oaknut/impl/patch.hpp"
+
 namespace oaknut {
 
+// If the memory cannot be allocated, std::bad_alloc is thrown; without exception support, CodeBlockAllocationFailed is
+// reported instead and the block is left empty (with a null ptr() and a size() of 0).
 class CodeBlock {
 public:
-    explicit CodeBlock(std::size_t size)
-        : m_size(size)
+    explicit CodeBlock(std::size_t size, const CodeBlockOptions& options = {})
+        : m_size(detail::allocation_size(size, options))
     {
 #if defined(_WIN32)
-        m_memory = (std::uint32_t*)VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
-#elif defined(__APPLE__)
-#    if TARGET_OS_IPHONE
-        m_memory = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_ANON | MAP_PRIVATE, -1, 0);
-#    else
-        m_memory = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE | MAP_JIT, -1, 0);
-#    endif
-#elif defined(__NetBSD__)
-        m_memory = (std::uint32_t*)mmap(nullptr, size, PROT_MPROTECT(PROT_READ | PROT_WRITE | PROT_EXEC), MAP_ANON | MAP_PRIVATE, -1, 0);
-#elif defined(__OpenBSD__)
-        m_memory = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_ANON | MAP_PRIVATE, -1, 0);
+        if (options.near != nullptr) {
+            m_memory = (std::uint32_t*)detail::map_near(options, m_size, detail::page_size(), [&](void* hint) {
+                return VirtualAlloc(hint, m_size, MEM_RESERVE | MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+            });
+        }
+        if (m_memory == nullptr)
+            m_memory = (std::uint32_t*)VirtualAlloc(nullptr, m_size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
 #else
-        m_memory = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE, -1, 0);
+        m_memory = (std::uint32_t*)map(m_size, options);
 #endif
-
-        if (m_memory == nullptr)
-            throw std::bad_alloc{};
+        if (m_memory == nullptr) {
+            m_size = 0;
+            detail::report_allocation_failure();
+        }
     }
 
     ~CodeBlock()
@@ -70,6 +73,23 @@ public:
         return m_memory;
     }
 
+    /// Same as ptr(), for code that handles CodeBlock and DualCodeBlock alike.
+    std::uint32_t* wptr() const
+    {
+        return m_memory;
+    }
+
+    /// Same as ptr(), for code that handles CodeBlock and DualCodeBlock alike.
+    std::uint32_t* xptr() const
+    {
+        return m_memory;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
     void protect()
     {
 #if defined(__APPLE__) && !TARGET_OS_IPHONE
@@ -90,53 +110,147 @@ public:
 
     void invalidate(std::uint32_t* mem, std::size_t size)
     {
-#if defined(__APPLE__)
-        sys_icache_invalidate(mem, size);
-#elif defined(_WIN32)
-        FlushInstructionCache(GetCurrentProcess(), mem, size);
-#else
-        static std::size_t icache_line_size = 0x10000, dcache_line_size = 0x10000;
+        detail::invalidate_icache(mem, size);
+    }
+
+    /// Invalidates all of the ranges (of executable addresses) with a single pair of barriers.
+    void invalidate(const DirtyRanges& ranges)
+    {
+        detail::invalidate_icache(ranges.ranges());
+    }
+
+    void invalidate_all()
+    {
+        invalidate(m_memory, m_size);
+    }
 
-        std::uint64_t ctr;
-        __asm__ volatile("mrs %0, ctr_el0"
-                         : "=r"(ctr));
+    /// Invalidates ranges and then makes every thread of the process context-synchronize, so that any of them may
+    /// immediately run the new code. Returns false if the latter is unsupported (it requires Linux 4.16 or later);
+    /// other threads must then execute an ISB before running the new code.
+    bool publish(const DirtyRanges& ranges)
+    {
+        invalidate(ranges);
+        return detail::synchronize_all_threads();
+    }
 
-        const std::size_t isize = icache_line_size = std::min<std::size_t>(icache_line_size, 4 << ((ctr >> 0) & 0xf));
-        const std::size_t dsize = dcache_line_size = std::min<std::size_t>(dcache_line_size, 4 << ((ctr >> 16) & 0xf));
+    bool publish(std::uint32_t* mem, std::size_t size)
+    {
+        invalidate(mem, size);
+        return detail::synchronize_all_threads();
+    }
 
-        const std::uintptr_t end = (std::uintptr_t)mem + size;
+    /// Atomically replaces the instruction at mem, which other threads may be executing, and invalidates only the
+    /// cache line containing it. Both the old and the new instruction must satisfy is_cmodx_safe (B, BL, NOP, BRK,
+    /// SVC, HVC, SMC or ISB); otherwise UnsafePatch is reported and nothing is written.
+    /// On platforms that enforce W^X, the block must be unprotected.
+    void patch(std::uint32_t* mem, std::uint32_t instruction)
+    {
+        const PatchSite site{mem, instruction};
+        detail::patch_instructions(m_memory, m_memory, {&site, 1});
+    }
 
-        for (std::uintptr_t addr = ((std::uintptr_t)mem) & ~(dsize - 1); addr < end; addr += dsize) {
-            __asm__ volatile("dc cvau, %0"
-                             :
-                             : "r"(addr)
-                             : "memory");
-        }
-        __asm__ volatile("dsb ish\n"
-                         :
-                         :
-                         : "memory");
-
-        for (std::uintptr_t addr = ((std::uintptr_t)mem) & ~(isize - 1); addr < end; addr += isize) {
-            __asm__ volatile("ic ivau, %0"
-                             :
-                             : "r"(addr)
-                             : "memory");
-        }
-        __asm__ volatile("dsb ish\nisb\n"
-                         :
-                         :
-                         : "memory");
-#endif
+    /// Patches several sites with one round of cache maintenance. Either all sites are written or, if any is not
+    /// safe to patch, none are.
+    void patch(std::span<const PatchSite> sites)
+    {
+        detail::patch_instructions(m_memory, m_memory, sites);
     }
 
-    void invalidate_all()
+    /// Atomically replaces the naturally aligned 64-bit value at mem, such as a literal loaded by code that may be
+    /// executing. No cache maintenance is required.
+    /// On platforms that enforce W^X, the block must be unprotected.
+    void patch_literal(std::uint64_t* mem, std::uint64_t value)
     {
-        invalidate(m_memory, m_size);
+        detail::patch_data(m_memory, m_memory, mem, value);
     }
 
 protected:
-    std::uint32_t* m_memory;
+#if !defined(_WIN32)
+    // Returns nullptr on failure.
+    static void* map(std::size_t size, const CodeBlockOptions& options)
+    {
+#    if defined(__APPLE__) && TARGET_OS_IPHONE
+        constexpr int prot = PROT_READ | PROT_EXEC;
+        int flags = MAP_ANON | MAP_PRIVATE;
+#    elif defined(__APPLE__)
+        constexpr int prot = PROT_READ | PROT_WRITE | PROT_EXEC;
+        int flags = MAP_ANON | MAP_PRIVATE | MAP_JIT;
+#    elif defined(__NetBSD__)
+        constexpr int prot = PROT_MPROTECT(PROT_READ | PROT_WRITE | PROT_EXEC);
+        int flags = MAP_ANON | MAP_PRIVATE;
+#    elif defined(__OpenBSD__)
+        constexpr int prot = PROT_READ | PROT_EXEC;
+        int flags = MAP_ANON | MAP_PRIVATE;
+#    else
+        constexpr int prot = PROT_READ | PROT_WRITE | PROT_EXEC;
+        int flags = MAP_ANON | MAP_PRIVATE;
+#    endif
+#    if defined(MAP_POPULATE)
+        if (options.prefault)
+            flags |= MAP_POPULATE;
+#    endif
+
+        // Maps exactly at hint, or anywhere if hint is nullptr.
+        const auto map_at = [&](void* hint, int extra_flags) -> void* {
+#    if defined(MAP_FIXED_NOREPLACE)
+            if (hint != nullptr)
+                extra_flags |= MAP_FIXED_NOREPLACE;
+#    endif
+            void* memory = mmap(hint, size, prot, flags | extra_flags, -1, 0);
+            if (memory == MAP_FAILED)
+                return nullptr;
+            if (hint != nullptr && memory != hint) {
+                munmap(memory, size);
+                return nullptr;
+            }
+            return memory;
+        };
+
+#    if defined(MAP_HUGETLB)
+        if (detail::huge_pages(options) == HugePages::Explicit) {
+            const auto map_hugetlb = [&](void* hint) { return map_at(hint, MAP_HUGETLB); };
+            void* memory = options.near != nullptr ? detail::map_near(options, size, detail::huge_page_size(), map_hugetlb) : map_hugetlb(nullptr);
+            if (memory != nullptr)
+                return memory;
+        }
+#    endif
+
+        const bool huge_pages = detail::huge_pages(options) != HugePages::None;
+        const std::size_t alignment = huge_pages ? detail::huge_page_size() : detail::page_size();
+
+        void* memory = nullptr;
+        if (options.near != nullptr)
+            memory = detail::map_near(options, size, alignment, [&](void* hint) { return map_at(hint, 0); });
+        if (memory == nullptr && !huge_pages)
+            memory = map_at(nullptr, 0);
+        if (memory == nullptr && huge_pages) {
+            // Transparent huge pages can only back huge-page-aligned memory, so reserve enough to align the block
+            // and release the excess.
+            char* const reservation = (char*)mmap(nullptr, size + alignment, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+            if (reservation == MAP_FAILED)
+                return nullptr;
+
+            char* const aligned = (char*)(((std::uintptr_t)reservation + alignment - 1) & ~(alignment - 1));
+            if (aligned != reservation)
+                munmap(reservation, aligned - reservation);
+            munmap(aligned + size, reservation + alignment - aligned);
+
+            memory = mmap(aligned, size, prot, flags | MAP_FIXED, -1, 0);
+            if (memory == MAP_FAILED) {
+                munmap(aligned, size);
+                return nullptr;
+            }
+        }
+
+#    if defined(MADV_HUGEPAGE)
+        if (memory != nullptr && huge_pages)
+            madvise(memory, size, MADV_HUGEPAGE);
+#    endif
+        return memory;
+    }
+#endif
+
+    std::uint32_t* m_memory = nullptr;
     std::size_t m_size = 0;
 };
 
@@ -0,0 +1,258 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "oaknut/impl/code_block_options.hpp"
+#include "oaknut/impl/dirty_ranges.hpp"
+#include "oaknut/oaknut_exception.hpp"
+
+namespace oaknut {
+
+// Code memory allocated from a CodeCache. Sizes are in bytes.
+struct CodeHandle {
+    std::uint32_t* wptr = nullptr;
+    std::uint32_t* xptr = nullptr;
+    std::size_t size = 0;
+
+    explicit operator bool() const
+    {
+        return xptr != nullptr;
+    }
+};
+
+struct CodeCacheStats {
+    std::size_t committed = 0;   // bytes of all regions
+    std::size_t used = 0;        // bytes of live allocations
+    std::size_t fragmented = 0;  // freed bytes that are only reusable by allocations that fit them
+};
+
+// Allocates code memory for many functions from one or more executable regions of region_size bytes each, rounded up
+// as the block rounds it.
+// Block is CodeBlock or DualCodeBlock; a region is added when the previous ones are exhausted, up to max_regions.
+// Regions are allocated with the given options.
+//
+// Allocations are bump-allocated from the newest region, and are aligned to and rounded up to granule bytes. Freed
+// allocations up to small_limit bytes are kept on per-size free lists and reused exactly; larger ones are reused
+// best-fit, with the remainder freed again. Freed memory is not coalesced.
+//
+// Changes of protection and cache maintenance are batched: call unprotect() before writing any number of
+// functions, and commit() once afterwards. Not thread-safe.
+template<typename Block>
+class CodeCache {
+public:
+    static constexpr std::size_t granule = 64;
+    static constexpr std::size_t small_limit = 4096;
+
+    explicit CodeCache(std::size_t region_size, std::size_t max_regions = 1, const CodeBlockOptions& options = {})
+        : m_region_size(detail::allocation_size(region_size, options) & ~(granule - 1)), m_max_regions(max_regions), m_options(options)
+    {}
+
+    CodeCache(const CodeCache&) = delete;
+    CodeCache& operator=(const CodeCache&) = delete;
+
+    // Allocates at least size bytes. Reports CodeCacheFull (and returns an empty handle) if there is no space left.
+    CodeHandle allocate(std::size_t size)
+    {
+        size = round_up(std::max<std::size_t>(size, 1));
+        if (size > m_region_size) {
+            detail::report_error(ExceptionType::CodeCacheFull);
+            return {};
+        }
+
+        CodeHandle handle = take_free(size);
+        if (!handle)
+            handle = bump(size);
+        if (!handle) {
+            detail::report_error(ExceptionType::CodeCacheFull);
+            return {};
+        }
+
+        m_used += handle.size;
+        m_dirty.add(handle.xptr, handle.size);
+        return handle;
+    }
+
+    // Returns the tail of handle beyond size bytes to the cache, for example once the size of emitted code is known.
+    // As with allocate, at least one granule is kept, so handle must still be freed.
+    void shrink(CodeHandle& handle, std::size_t size)
+    {
+        size = round_up(std::max<std::size_t>(size, 1));
+        if (size >= handle.size)
+            return;
+
+        const std::size_t words = size / sizeof(std::uint32_t);
+        release(handle.wptr + words, handle.xptr + words, handle.size - size);
+        m_used -= handle.size - size;
+        handle.size = size;
+    }
+
+    // No thread may still be executing the code in handle.
+    void free(const CodeHandle& handle)
+    {
+        if (!handle)
+            return;
+        release(handle.wptr, handle.xptr, handle.size);
+        m_used -= handle.size;
+    }
+
+    // Makes all regions writable, on platforms that enforce W^X.
+    void unprotect()
+    {
+        m_writable = true;
+        if constexpr (requires(Block& block) { block.unprotect(); }) {
+            for (const auto& region : m_regions)
+                region->unprotect();
+        }
+    }
+
+    // Makes all regions executable again, on platforms that enforce W^X.
+    void protect()
+    {
+        m_writable = false;
+        if constexpr (requires(Block& block) { block.protect(); }) {
+            for (const auto& region : m_regions)
+                region->protect();
+        }
+    }
+
+    // Invalidates the instruction cache for everything allocated since the last commit, with a single pair of
+    // barriers. Adjacent and overlapping allocations are invalidated together.
+    void commit()
+    {
+        if (m_dirty.empty())
+            return;
+
+        // Invalidation is by address, so any region can perform it.
+        m_dirty.normalize();
+        m_regions.front()->invalidate(m_dirty);
+        m_dirty.clear();
+    }
+
+    // As commit(), but also makes every thread context-synchronize, so that any of them may immediately run the
+    // committed code. Returns false if that is unsupported; see CodeBlock::publish.
+    bool publish()
+    {
+        if (m_regions.empty())
+            return true;
+
+        m_dirty.normalize();
+        const bool synchronized = m_regions.front()->publish(m_dirty);
+        m_dirty.clear();
+        return synchronized;
+    }
+
+    CodeCacheStats stats() const
+    {
+        return CodeCacheStats{m_regions.size() * m_region_size, m_used, m_fragmented};
+    }
+
+    std::size_t region_size() const
+    {
+        return m_region_size;
+    }
+
+private:
+    static std::size_t round_up(std::size_t size)
+    {
+        return (size + granule - 1) & ~(granule - 1);
+    }
+
+    struct FreeRange {
+        std::uint32_t* wptr;
+        std::uint32_t* xptr;
+    };
+
+    CodeHandle take_free(std::size_t size)
+    {
+        if (size <= small_limit) {
+            std::vector<FreeRange>& list = m_small[size / granule - 1];
+            if (!list.empty()) {
+                const FreeRange range = list.back();
+                list.pop_back();
+                m_fragmented -= size;
+                return CodeHandle{range.wptr, range.xptr, size};
+            }
+        }
+
+        const auto iter = m_large.lower_bound(size);
+        if (iter == m_large.end())
+            return {};
+
+        const auto [range_size, range] = *iter;
+        m_large.erase(iter);
+        m_fragmented -= range_size;
+
+        const std::size_t words = size / sizeof(std::uint32_t);
+        if (range_size != size)
+            release(range.wptr + words, range.xptr + words, range_size - size);
+        return CodeHandle{range.wptr, range.xptr, size};
+    }
+
+    CodeHandle bump(std::size_t size)
+    {
+        if (m_regions.empty() || m_region_size - m_bump < size) {
+            if (m_regions.size() == m_max_regions)
+                return {};
+
+            // Without exception support, a block that failed to map is empty and has reported the failure.
+            auto block = std::make_unique<Block>(m_region_size, m_options);
+            if (block->xptr() == nullptr)
+                return {};
+
+            if (!m_regions.empty() && m_bump != m_region_size) {
+                const Block& last = *m_regions.back();
+                const std::size_t words = m_bump / sizeof(std::uint32_t);
+                release(last.wptr() + words, last.xptr() + words, m_region_size - m_bump);
+            }
+
+            m_regions.push_back(std::move(block));
+            m_bump = 0;
+            if constexpr (requires(Block& block) { block.unprotect(); }) {
+                if (m_writable)
+                    m_regions.back()->unprotect();
+            }
+        }
+
+        const Block& region = *m_regions.back();
+        const std::size_t words = m_bump / sizeof(std::uint32_t);
+        m_bump += size;
+        return CodeHandle{region.wptr() + words, region.xptr() + words, size};
+    }
+
+    void release(std::uint32_t* wptr, std::uint32_t* xptr, std::size_t size)
+    {
+        if (size == 0)
+            return;
+        m_fragmented += size;
+        if (size <= small_limit)
+            m_small[size / granule - 1].push_back(FreeRange{wptr, xptr});
+        else
+            m_large.emplace(size, FreeRange{wptr, xptr});
+    }
+
+    std::size_t m_region_size;
+    std::size_t m_max_regions;
+    CodeBlockOptions m_options;
+    std::vector<std::unique_ptr<Block>> m_regions;
+    std::size_t m_bump = 0;  // bytes allocated from the newest region
+    bool m_writable = false;
+
+    std::array<std::vector<FreeRange>, small_limit / granule> m_small;
+    std::multimap<std::size_t, FreeRange> m_large;
+
+    std::size_t m_used = 0;
+    std::size_t m_fragmented = 0;
+    DirtyRanges m_dirty;  // allocations since commit()
+};
+
+}  // namespace oaknut
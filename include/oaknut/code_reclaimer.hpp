@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+
+#include "oaknut/code_cache.hpp"
+#include "oaknut/oaknut_exception.hpp"
+
+namespace oaknut {
+
+// Frees code retired from a Cache (such as CodeCache) once no thread can still be executing it, using quiescent-state
+// based reclamation.
+//
+// Threads that run code from the cache register with the reclaimer and periodically report a quiescent state: a safe
+// point at which they are not executing, and hold no return address into, any code from the cache. A retired handle
+// is freed back to the cache, where its memory is reused by later allocations, once every registered thread has
+// passed a safe point since it was retired. A thread that will not run such code for a while (for example, while it
+// waits for work) goes offline, so that it does not hold up reclamation.
+//
+// Before a handle is retired, the caller must have made the code unreachable (for example with
+// CallSiteTable::unlink); threads may still be executing it. quiescent(), offline() and online() are lock-free and
+// may be called from any registered thread. retire() and reclaim() use the cache, so must be serialized with other
+// uses of it.
+template<typename Cache>
+class CodeReclaimer {
+public:
+    static constexpr std::size_t default_max_threads = 64;
+
+    explicit CodeReclaimer(Cache& cache, std::size_t max_threads = default_max_threads)
+        : m_cache(cache), m_max_threads(max_threads), m_slots(std::make_unique<Slot[]>(max_threads))
+    {}
+
+    CodeReclaimer(const CodeReclaimer&) = delete;
+    CodeReclaimer& operator=(const CodeReclaimer&) = delete;
+
+    // Registers the calling thread, which is initially online. Returns the thread's index for the other calls.
+    // Reports TooManyThreads (and returns max_threads) if all slots are taken.
+    std::size_t register_thread()
+    {
+        for (std::size_t i = 0; i < m_max_threads; i++) {
+            std::uint64_t expected = unused;
+            if (m_slots[i].epoch.compare_exchange_strong(expected, m_epoch.load()))
+                return i;
+        }
+        detail::report_error(ExceptionType::TooManyThreads);
+        return m_max_threads;
+    }
+
+    void unregister_thread(std::size_t thread)
+    {
+        m_slots[thread].epoch.store(unused);
+    }
+
+    // Reports that thread is at a safe point.
+    void quiescent(std::size_t thread)
+    {
+        m_slots[thread].epoch.store(m_epoch.load());
+    }
+
+    // Reports that thread will not run code from the cache until it calls online().
+    void offline(std::size_t thread)
+    {
+        m_slots[thread].epoch.store(offline_epoch);
+    }
+
+    void online(std::size_t thread)
+    {
+        quiescent(thread);
+    }
+
+    // Schedules handle to be freed once every registered thread has passed a safe point.
+    void retire(const CodeHandle& handle)
+    {
+        if (!handle)
+            return;
+        m_retired.push_back(Retired{handle, m_epoch.fetch_add(1)});
+        m_pending += handle.size;
+    }
+
+    // Frees every retired handle that no thread can still be executing. Returns the number of bytes freed.
+    std::size_t reclaim()
+    {
+        std::uint64_t oldest = offline_epoch;
+        for (std::size_t i = 0; i < m_max_threads; i++) {
+            const std::uint64_t epoch = m_slots[i].epoch.load();
+            if (epoch != unused)
+                oldest = std::min(oldest, epoch);
+        }
+
+        std::size_t freed = 0;
+        while (!m_retired.empty() && m_retired.front().epoch < oldest) {
+            m_cache.free(m_retired.front().handle);
+            freed += m_retired.front().handle.size;
+            m_retired.pop_front();
+        }
+        m_pending -= freed;
+        return freed;
+    }
+
+    // Bytes retired but not yet freed.
+    std::size_t pending() const
+    {
+        return m_pending;
+    }
+
+private:
+    static constexpr std::uint64_t unused = 0;
+    static constexpr std::uint64_t offline_epoch = std::numeric_limits<std::uint64_t>::max();
+
+    // Each slot is on its own cache line, so that threads reporting safe points do not contend.
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> epoch = unused;  // epoch observed at the thread's last safe point
+    };
+
+    struct Retired {
+        CodeHandle handle;
+        std::uint64_t epoch;  // epoch during which handle was retired
+    };
+
+    Cache& m_cache;
+    const std::size_t m_max_threads;
+    std::unique_ptr<Slot[]> m_slots;
+    std::atomic<std::uint64_t> m_epoch = 1;
+    std::deque<Retired> m_retired;  // in order of retirement, so also of epoch
+    std::size_t m_pending = 0;
+};
+
+}  // namespace oaknut
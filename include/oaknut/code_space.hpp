@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "oaknut/code_cache.hpp"
+#include "oaknut/impl/dirty_ranges.hpp"
+#include "oaknut/oaknut_exception.hpp"
+
+namespace oaknut {
+
+// Code memory in a Block (CodeBlock or DualCodeBlock) shared by many threads without locking.
+// Threads reserve chunks by atomically bumping the top of the space, and return unused tails: a tail is reclaimed if
+// no later chunk has been reserved, and is otherwise counted as wasted. Usually used through CodeSpaceArena.
+template<typename Block>
+class ConcurrentCodeSpace {
+public:
+    static constexpr std::size_t granule = 64;
+
+    explicit ConcurrentCodeSpace(Block& block)
+        : m_block(block), m_capacity(block.size() & ~(granule - 1))
+    {}
+
+    ConcurrentCodeSpace(const ConcurrentCodeSpace&) = delete;
+    ConcurrentCodeSpace& operator=(const ConcurrentCodeSpace&) = delete;
+
+    // Reserves at least size bytes. Reports CodeCacheFull (and returns an empty handle) if there is no space left.
+    CodeHandle reserve(std::size_t size)
+    {
+        size = (size + granule - 1) & ~(granule - 1);
+
+        std::size_t top = m_top.load(std::memory_order_relaxed);
+        do {
+            if (size > m_capacity - top) {
+                detail::report_error(ExceptionType::CodeCacheFull);
+                return {};
+            }
+        } while (!m_top.compare_exchange_weak(top, top + size, std::memory_order_relaxed));
+
+        const std::size_t words = top / sizeof(std::uint32_t);
+        return CodeHandle{m_block.wptr() + words, m_block.xptr() + words, size};
+    }
+
+    // Returns the part of chunk beyond used bytes.
+    void release_tail(const CodeHandle& chunk, std::size_t used)
+    {
+        used = (used + granule - 1) & ~(granule - 1);
+        if (!chunk || used >= chunk.size)
+            return;
+
+        const std::size_t begin = static_cast<std::size_t>(chunk.xptr - m_block.xptr()) * sizeof(std::uint32_t);
+        std::size_t end = begin + chunk.size;
+        if (!m_top.compare_exchange_strong(end, begin + used, std::memory_order_relaxed))
+            m_wasted.fetch_add(chunk.size - used, std::memory_order_relaxed);
+    }
+
+    // Bytes reserved and not returned, including wasted bytes.
+    std::size_t used() const
+    {
+        return m_top.load(std::memory_order_relaxed);
+    }
+
+    // Bytes of tails that could not be returned.
+    std::size_t wasted() const
+    {
+        return m_wasted.load(std::memory_order_relaxed);
+    }
+
+    std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    Block& block() const
+    {
+        return m_block;
+    }
+
+private:
+    Block& m_block;
+    const std::size_t m_capacity;
+    std::atomic<std::size_t> m_top = 0;
+    std::atomic<std::size_t> m_wasted = 0;
+};
+
+// A single thread's allocator over a ConcurrentCodeSpace. Functions are allocated from a chunk reserved from the space
+// without further synchronization, and the unused tail of the chunk is returned when a new chunk is needed or the
+// arena is destroyed. Each arena tracks and publishes only the code allocated from it.
+template<typename Block>
+class CodeSpaceArena {
+public:
+    static constexpr std::size_t default_chunk_size = 256 * 1024;
+
+    explicit CodeSpaceArena(ConcurrentCodeSpace<Block>& space, std::size_t chunk_size = default_chunk_size)
+        : m_space(space), m_chunk_size(chunk_size)
+    {}
+
+    ~CodeSpaceArena()
+    {
+        m_space.release_tail(m_chunk, m_used);
+    }
+
+    CodeSpaceArena(const CodeSpaceArena&) = delete;
+    CodeSpaceArena& operator=(const CodeSpaceArena&) = delete;
+
+    // Allocates at least size bytes, aligned to ConcurrentCodeSpace::granule.
+    CodeHandle allocate(std::size_t size)
+    {
+        size = (size + granule - 1) & ~(granule - 1);
+        if (size > m_chunk.size - m_used) {
+            // The tail is returned first, as it can only be reclaimed while nothing has been reserved after it.
+            m_space.release_tail(m_chunk, m_used);
+            m_chunk.size = m_used;
+
+            const CodeHandle chunk = m_space.reserve(std::max(size, m_chunk_size));
+            if (!chunk)
+                return {};
+            m_chunk = chunk;
+            m_used = 0;
+        }
+
+        const std::size_t words = m_used / sizeof(std::uint32_t);
+        m_used += size;
+        m_dirty.add(m_chunk.xptr + words, size);
+        return CodeHandle{m_chunk.wptr + words, m_chunk.xptr + words, size};
+    }
+
+    // Returns the tail of handle beyond size bytes to the arena, if handle is the arena's most recent allocation.
+    void shrink(CodeHandle& handle, std::size_t size)
+    {
+        size = (size + granule - 1) & ~(granule - 1);
+        if (size >= handle.size)
+            return;
+        if (handle.xptr + handle.size / sizeof(std::uint32_t) != m_chunk.xptr + m_used / sizeof(std::uint32_t))
+            return;
+
+        m_used -= handle.size - size;
+        handle.size = size;
+    }
+
+    // Invalidates the code allocated since the last commit or publish with a single pair of barriers.
+    void commit()
+    {
+        m_dirty.normalize();
+        m_space.block().invalidate(m_dirty);
+        m_dirty.clear();
+    }
+
+    // As commit(), but also makes every thread context-synchronize; see CodeBlock::publish.
+    bool publish()
+    {
+        m_dirty.normalize();
+        const bool synchronized = m_space.block().publish(m_dirty);
+        m_dirty.clear();
+        return synchronized;
+    }
+
+private:
+    static constexpr std::size_t granule = ConcurrentCodeSpace<Block>::granule;
+
+    ConcurrentCodeSpace<Block>& m_space;
+    const std::size_t m_chunk_size;
+    CodeHandle m_chunk;
+    std::size_t m_used = 0;
+    DirtyRanges m_dirty;
+};
+
+}  // namespace oaknut
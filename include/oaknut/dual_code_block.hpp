@@ -3,20 +3,20 @@
 
 #pragma once
 
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <new>
+#include <span>
 
 #if defined(_WIN32)
-#    define NOMINMAX
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
 #    include <windows.h>
 #elif defined(__APPLE__)
 #    include <mach/mach.h>
 #    include <mach/vm_map.h>
 
 #    include <TargetConditionals.h>
-#    include <libkern/OSCacheControl.h>
 #    include <pthread.h>
 #    include <sys/mman.h>
 #    include <unistd.h>
@@ -29,50 +29,93 @@
 #    include <unistd.h>
 #endif
 
+#include "oaknut/impl/cache_maintenance.hpp"
+#include "oaknut/impl/code_block_options.hpp"
+#include "oaknut/impl/patch.hpp"
+
 namespace oaknut {
 
+// Allocation failure is handled as for CodeBlock.
 class DualCodeBlock {
 public:
-    explicit DualCodeBlock(std::size_t size)
-        : m_size(size)
+    explicit DualCodeBlock(std::size_t size, const CodeBlockOptions& options = {})
+        : m_size(detail::allocation_size(size, options))
     {
 #if defined(_WIN32)
-        m_wmem = m_xmem = (std::uint32_t*)VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
-        if (m_wmem == nullptr)
-            throw std::bad_alloc{};
+        if (options.near != nullptr) {
+            m_xmem = (std::uint32_t*)detail::map_near(options, m_size, detail::page_size(), [&](void* hint) {
+                return VirtualAlloc(hint, m_size, MEM_RESERVE | MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+            });
+        }
+        if (m_xmem == nullptr)
+            m_xmem = (std::uint32_t*)VirtualAlloc(nullptr, m_size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+        if (m_xmem == nullptr) {
+            fail();
+            return;
+        }
+        m_wmem = m_xmem;
 #elif defined(__APPLE__)
-        m_wmem = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
-        if (m_wmem == MAP_FAILED)
-            throw std::bad_alloc{};
+        m_wmem = (std::uint32_t*)mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+        if (m_wmem == MAP_FAILED) {
+            m_wmem = nullptr;
+            fail();
+            return;
+        }
 
         vm_prot_t cur_prot, max_prot;
-        kern_return_t ret = vm_remap(mach_task_self(), (vm_address_t*)&m_xmem, size, 0, VM_FLAGS_ANYWHERE | VM_FLAGS_RANDOM_ADDR, mach_task_self(), (mach_vm_address_t)m_wmem, false, &cur_prot, &max_prot, VM_INHERIT_NONE);
-        if (ret != KERN_SUCCESS)
-            throw std::bad_alloc{};
+        kern_return_t ret = vm_remap(mach_task_self(), (vm_address_t*)&m_xmem, m_size, 0, VM_FLAGS_ANYWHERE | VM_FLAGS_RANDOM_ADDR, mach_task_self(), (mach_vm_address_t)m_wmem, false, &cur_prot, &max_prot, VM_INHERIT_NONE);
+        if (ret != KERN_SUCCESS) {
+            fail();
+            return;
+        }
 
-        mprotect(m_xmem, size, PROT_READ | PROT_EXEC);
+        mprotect(m_xmem, m_size, PROT_READ | PROT_EXEC);
 #else
 #    if defined(__OpenBSD__)
         char tmpl[] = "oaknut_dual_code_block.XXXXXXXXXX";
         fd = shm_mkstemp(tmpl);
-        if (fd < 0)
-            throw std::bad_alloc{};
+        if (fd < 0) {
+            fail();
+            return;
+        }
         shm_unlink(tmpl);
+
+        if (!map_shared(options)) {
+            fail();
+            return;
+        }
 #    else
-        fd = memfd_create("oaknut_dual_code_block", 0);
-        if (fd < 0)
-            throw std::bad_alloc{};
-#    endif
+#        if defined(MFD_HUGETLB)
+        // Falls back to transparent huge pages if the hugetlbfs pool is exhausted
+        if (detail::huge_pages(options) == HugePages::Explicit) {
+            fd = memfd_create("oaknut_dual_code_block", MFD_HUGETLB);
+            if (fd >= 0 && map_shared(options))
+                return;
+            if (fd >= 0)
+                close(fd);
+        }
+#        endif
 
-        int ret = ftruncate(fd, size);
-        if (ret != 0)
-            throw std::bad_alloc{};
+        fd = memfd_create("oaknut_dual_code_block", 0);
+        if (fd < 0) {
+            fail();
+            return;
+        }
 
-        m_wmem = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-        m_xmem = (std::uint32_t*)mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+        if (!map_shared(options)) {
+            fail();
+            return;
+        }
 
-        if (m_wmem == MAP_FAILED || m_xmem == MAP_FAILED)
-            throw std::bad_alloc{};
+#        if defined(MADV_HUGEPAGE)
+        // Shared memory is only backed by transparent huge pages if /sys/kernel/mm/transparent_hugepage/shmem_enabled
+        // allows it.
+        if (detail::huge_pages(options) != HugePages::None) {
+            madvise(m_wmem, m_size, MADV_HUGEPAGE);
+            madvise(m_xmem, m_size, MADV_HUGEPAGE);
+        }
+#        endif
+#    endif
 #endif
     }
 
@@ -82,9 +125,12 @@ public:
         VirtualFree((void*)m_xmem, 0, MEM_RELEASE);
 #elif defined(__APPLE__)
 #else
-        munmap(m_wmem, m_size);
-        munmap(m_xmem, m_size);
-        close(fd);
+        if (m_wmem != nullptr)
+            munmap(m_wmem, m_size);
+        if (m_xmem != nullptr)
+            munmap(m_xmem, m_size);
+        if (fd >= 0)
+            close(fd);
 #endif
     }
 
@@ -105,56 +151,131 @@ public:
         return m_wmem;
     }
 
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
     /// Invalidate should be used with executable memory pointers.
     void invalidate(std::uint32_t* mem, std::size_t size)
     {
-#if defined(__APPLE__)
-        sys_icache_invalidate(mem, size);
-#elif defined(_WIN32)
-        FlushInstructionCache(GetCurrentProcess(), mem, size);
-#else
-        static std::size_t icache_line_size = 0x10000, dcache_line_size = 0x10000;
+        detail::invalidate_icache(mem, size);
+    }
 
-        std::uint64_t ctr;
-        __asm__ volatile("mrs %0, ctr_el0"
-                         : "=r"(ctr));
+    /// Invalidates all of the ranges (of executable addresses) with a single pair of barriers.
+    void invalidate(const DirtyRanges& ranges)
+    {
+        detail::invalidate_icache(ranges.ranges());
+    }
 
-        const std::size_t isize = icache_line_size = std::min<std::size_t>(icache_line_size, 4 << ((ctr >> 0) & 0xf));
-        const std::size_t dsize = dcache_line_size = std::min<std::size_t>(dcache_line_size, 4 << ((ctr >> 16) & 0xf));
+    void invalidate_all()
+    {
+        invalidate(m_xmem, m_size);
+    }
 
-        const std::uintptr_t end = (std::uintptr_t)mem + size;
+    /// Invalidates ranges and then makes every thread of the process context-synchronize, so that any of them may
+    /// immediately run the new code. Returns false if the latter is unsupported (it requires Linux 4.16 or later);
+    /// other threads must then execute an ISB before running the new code.
+    bool publish(const DirtyRanges& ranges)
+    {
+        invalidate(ranges);
+        return detail::synchronize_all_threads();
+    }
 
-        for (std::uintptr_t addr = ((std::uintptr_t)mem) & ~(dsize - 1); addr < end; addr += dsize) {
-            __asm__ volatile("dc cvau, %0"
-                             :
-                             : "r"(addr)
-                             : "memory");
-        }
-        __asm__ volatile("dsb ish\n"
-                         :
-                         :
-                         : "memory");
-
-        for (std::uintptr_t addr = ((std::uintptr_t)mem) & ~(isize - 1); addr < end; addr += isize) {
-            __asm__ volatile("ic ivau, %0"
-                             :
-                             : "r"(addr)
-                             : "memory");
-        }
-        __asm__ volatile("dsb ish\nisb\n"
-                         :
-                         :
-                         : "memory");
-#endif
+    bool publish(std::uint32_t* mem, std::size_t size)
+    {
+        invalidate(mem, size);
+        return detail::synchronize_all_threads();
     }
 
-    void invalidate_all()
+    /// Atomically replaces the instruction at xmem (an executable pointer), which other threads may be executing,
+    /// and invalidates only the cache line containing it. Both the old and the new instruction must satisfy
+    /// is_cmodx_safe (B, BL, NOP, BRK, SVC, HVC, SMC or ISB); otherwise UnsafePatch is reported and nothing is written.
+    void patch(std::uint32_t* xmem, std::uint32_t instruction)
     {
-        invalidate(m_xmem, m_size);
+        const PatchSite site{xmem, instruction};
+        detail::patch_instructions(m_wmem, m_xmem, {&site, 1});
+    }
+
+    /// Patches several sites (executable pointers) with one round of cache maintenance. Either all sites are
+    /// written or, if any is not safe to patch, none are.
+    void patch(std::span<const PatchSite> sites)
+    {
+        detail::patch_instructions(m_wmem, m_xmem, sites);
+    }
+
+    /// Atomically replaces the naturally aligned 64-bit value at xmem (an executable pointer), such as a literal
+    /// loaded by code that may be executing. No cache maintenance is required.
+    void patch_literal(std::uint64_t* xmem, std::uint64_t value)
+    {
+        detail::patch_data(m_wmem, m_xmem, xmem, value);
     }
 
 protected:
+    // Releases what has been allocated so far, leaves the block empty, and reports the failure.
+    OAKNUT_COLD void fail()
+    {
+#if defined(__APPLE__)
+        if (m_wmem != nullptr)
+            munmap(m_wmem, m_size);
+#elif !defined(_WIN32)
+        if (fd >= 0)
+            close(fd);
+        fd = -1;
+#endif
+        m_wmem = m_xmem = nullptr;
+        m_size = 0;
+        detail::report_allocation_failure();
+    }
+
 #if !defined(_WIN32) && !defined(__APPLE__)
+    // Maps both views of fd, which has been created but not sized.
+    bool map_shared(const CodeBlockOptions& options)
+    {
+        if (ftruncate(fd, m_size) != 0)
+            return false;
+
+        int flags = MAP_SHARED;
+#    if defined(MAP_POPULATE)
+        if (options.prefault)
+            flags |= MAP_POPULATE;
+#    endif
+
+        void* wmem = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, flags, fd, 0);
+        void* xmem = nullptr;
+        if (options.near != nullptr) {
+            const std::size_t alignment = detail::huge_pages(options) != HugePages::None ? detail::huge_page_size() : detail::page_size();
+            xmem = detail::map_near(options, m_size, alignment, [&](void* hint) -> void* {
+                int hint_flags = flags;
+#    if defined(MAP_FIXED_NOREPLACE)
+                hint_flags |= MAP_FIXED_NOREPLACE;
+#    endif
+                void* memory = mmap(hint, m_size, PROT_READ | PROT_EXEC, hint_flags, fd, 0);
+                if (memory == MAP_FAILED)
+                    return nullptr;
+                if (memory != hint) {
+                    munmap(memory, m_size);
+                    return nullptr;
+                }
+                return memory;
+            });
+        }
+        if (xmem == nullptr)
+            xmem = mmap(nullptr, m_size, PROT_READ | PROT_EXEC, flags, fd, 0);
+
+        if (wmem == MAP_FAILED || xmem == MAP_FAILED) {
+            if (wmem != MAP_FAILED)
+                munmap(wmem, m_size);
+            if (xmem != MAP_FAILED)
+                munmap(xmem, m_size);
+            return false;
+        }
+
+        m_wmem = (std::uint32_t*)wmem;
+        m_xmem = (std::uint32_t*)xmem;
+        return true;
+    }
+
     int fd = -1;
 #endif
     std::uint32_t* m_xmem = nullptr;
@@ -1,22 +1,37 @@
 // SPDX-FileCopyrightText: Copyright (c) 2022 merryhime <https://mary.rs>
 // SPDX-License-Identifier: MIT
 
+// Runs of contiguous bits in mask, as (bits of the source value, left shift to their position in mask)
+template<std::uint32_t mask>
+static constexpr auto pdep_runs()
+{
+    std::array<std::pair<std::uint32_t, int>, std::popcount(mask & ~(mask << 1))> runs{};
+    std::uint32_t rest = mask;
+    int consumed = 0;
+    for (auto& [bits, shift] : runs) {
+        const int lsb = std::countr_zero(rest);
+        const int width = std::countr_one(rest >> lsb);
+        bits = static_cast<std::uint32_t>(((std::uint64_t{1} << width) - 1) << consumed);
+        shift = lsb - consumed;
+        rest &= ~static_cast<std::uint32_t>(((std::uint64_t{1} << width) - 1) << lsb);
+        consumed += width;
+    }
+    return runs;
+}
+
+// Deposits the low bits of val into the set bits of mask_, one shift and mask per run of the mask (usually one).
 template<std::uint32_t mask_>
 static constexpr std::uint32_t pdep(std::uint32_t val)
 {
-    std::uint32_t mask = mask_;
-    std::uint32_t res = 0;
-    for (std::uint32_t bb = 1; mask; bb += bb) {
-        if (val & bb)
-            res |= mask & (~mask + 1);
-        mask &= mask - 1;
-    }
-    return res;
+    constexpr auto runs = pdep_runs<mask_>();
+    return [&]<std::size_t... i>(std::index_sequence<i...>) {
+        return (std::uint32_t{0} | ... | ((val & runs[i].first) << runs[i].second));
+    }(std::make_index_sequence<runs.size()>{});
 }
 
 #define OAKNUT_STD_ENCODE(TYPE, ACCESS, SIZE)                   \
     template<std::uint32_t splat>                               \
-    std::uint32_t encode(TYPE v)                                \
+    constexpr std::uint32_t encode(TYPE v)                      \
     {                                                           \
         static_assert(std::popcount(splat) == SIZE);            \
         return pdep<splat>(static_cast<std::uint32_t>(ACCESS)); \
@@ -50,162 +65,234 @@ OAKNUT_STD_ENCODE(PrfOp, v, 5)
 OAKNUT_STD_ENCODE(TlbiOp, v, 10)
 
 template<std::uint32_t splat>
-std::uint32_t encode(MovImm16 v)
+constexpr std::uint32_t encode(MovImm16 v)
 {
     static_assert(std::popcount(splat) == 17 || std::popcount(splat) == 18);
     if constexpr (std::popcount(splat) == 17) {
         constexpr std::uint32_t mask = (1 << std::popcount(splat)) - 1;
         if ((v.m_encoded & mask) != v.m_encoded)
-            throw OaknutException{ExceptionType::InvalidMovImm16};
+            detail::report_error(ExceptionType::InvalidMovImm16);
     }
     return pdep<splat>(v.m_encoded);
 }
 
 template<std::uint32_t splat, std::size_t imm_size>
-std::uint32_t encode(Imm<imm_size> v)
+constexpr std::uint32_t encode(Imm<imm_size> v)
 {
     static_assert(std::popcount(splat) >= imm_size);
     return pdep<splat>(v.value());
 }
 
 template<std::uint32_t splat, int A, int B>
-std::uint32_t encode(ImmChoice<A, B> v)
+constexpr std::uint32_t encode(ImmChoice<A, B> v)
 {
     static_assert(std::popcount(splat) == 1);
     return pdep<splat>(v.m_encoded);
 }
 
 template<std::uint32_t splat, int A, int B, int C, int D>
-std::uint32_t encode(ImmChoice<A, B, C, D> v)
+constexpr std::uint32_t encode(ImmChoice<A, B, C, D> v)
 {
     static_assert(std::popcount(splat) == 2);
     return pdep<splat>(v.m_encoded);
 }
 
 template<std::uint32_t splat, std::size_t size, std::size_t align>
-std::uint32_t encode(SOffset<size, align> v)
+constexpr std::uint32_t encode(SOffset<size, align> v)
 {
     static_assert(std::popcount(splat) == size - align);
     return pdep<splat>(v.m_encoded);
 }
 
 template<std::uint32_t splat, std::size_t size, std::size_t align>
-std::uint32_t encode(POffset<size, align> v)
+constexpr std::uint32_t encode(POffset<size, align> v)
 {
     static_assert(std::popcount(splat) == size - align);
     return pdep<splat>(v.m_encoded);
 }
 
 template<std::uint32_t splat>
-std::uint32_t encode(std::uint32_t v)
+constexpr std::uint32_t encode(std::uint32_t v)
 {
     return pdep<splat>(v);
 }
 
 template<std::uint32_t splat, typename T, size_t N>
-std::uint32_t encode(List<T, N> v)
+constexpr std::uint32_t encode(List<T, N> v)
 {
     return encode<splat>(v.m_base);
 }
 
+template<std::size_t size, std::size_t align>
+static constexpr detail::FixupKind addr_fixup_kind()
+{
+    static_assert(align == 2);
+    if constexpr (size == 28) {
+        return detail::FixupKind::Imm26;
+    } else if constexpr (size == 21) {
+        return detail::FixupKind::Imm19;
+    } else {
+        static_assert(size == 16);
+        return detail::FixupKind::Imm14;
+    }
+}
+
+template<std::size_t size, std::size_t align>
+static constexpr RelocationKind addr_relocation_kind()
+{
+    static_assert(align == 2);
+    if constexpr (size == 28) {
+        return RelocationKind::Branch26;
+    } else if constexpr (size == 21) {
+        return RelocationKind::Branch19;
+    } else {
+        static_assert(size == 16);
+        return RelocationKind::Branch14;
+    }
+}
+
+template<std::size_t size, std::size_t shift_amount>
+static constexpr detail::FixupKind page_fixup_kind()
+{
+    static_assert(size == 21);
+    if constexpr (shift_amount == 0) {
+        return detail::FixupKind::Adr;
+    } else {
+        static_assert(shift_amount == 12);
+        return detail::FixupKind::Adrp;
+    }
+}
+
 template<std::uint32_t splat, std::size_t size, std::size_t align>
-std::uint32_t encode(AddrOffset<size, align> v)
+constexpr std::uint32_t encode(AddrOffset<size, align> v)
 {
     static_assert(std::popcount(splat) == size - align);
 
-    const auto encode_fn = [](std::ptrdiff_t current_offset, std::ptrdiff_t target_offset) {
-        const std::ptrdiff_t diff = target_offset - current_offset;
+    switch (v.m_payload.kind) {
+    case detail::OffsetPayload::Kind::Encoded:
+        return pdep<splat>(v.m_payload.encoded);
+    case detail::OffsetPayload::Kind::Label: {
+        Label* label = v.m_payload.label;
+        if (label->m_offset) {
+            // Offsets are always multiples of four, so only the range of a displacement between them needs checking.
+            const auto diff = static_cast<std::uint64_t>(*label->m_offset - Policy::offset());
+            if (detail::sign_extend<size>(diff) != diff) [[unlikely]]
+                detail::report_error(ExceptionType::OffsetOutOfRange);
+            return pdep<splat>(static_cast<std::uint32_t>((diff & detail::mask_from_size(size)) >> align));
+        }
+        add_fixup(*label, addr_fixup_kind<size, align>());
+        return 0u;
+    }
+    case detail::OffsetPayload::Kind::Pointer: {
+        if (m_relocation_recording) {
+            add_relocation(addr_relocation_kind<size, align>(), false, reinterpret_cast<std::uintptr_t>(v.m_payload.ptr));
+            return 0u;
+        }
+        const std::ptrdiff_t diff = reinterpret_cast<std::uintptr_t>(v.m_payload.ptr) - Policy::template xptr<std::uintptr_t>();
         return pdep<splat>(AddrOffset<size, align>::encode(diff));
-    };
-
-    return std::visit(detail::overloaded{
-                          [&](std::uint32_t encoding) -> std::uint32_t {
-                              return pdep<splat>(encoding);
-                          },
-                          [&](Label* label) -> std::uint32_t {
-                              if (label->m_offset) {
-                                  return encode_fn(Policy::offset(), *label->m_offset);
-                              }
-
-                              label->m_wbs.emplace_back(Label::Writeback{Policy::offset(), ~splat, static_cast<Label::EmitFunctionType>(encode_fn)});
-                              return 0u;
-                          },
-                          [&](const void* p) -> std::uint32_t {
-                              const std::ptrdiff_t diff = reinterpret_cast<std::uintptr_t>(p) - Policy::template xptr<std::uintptr_t>();
-                              return pdep<splat>(AddrOffset<size, align>::encode(diff));
-                          },
-                      },
-                      v.m_payload);
+    }
+    }
+    return 0u;
 }
 
 template<std::uint32_t splat, std::size_t size, std::size_t shift_amount>
-std::uint32_t encode(PageOffset<size, shift_amount> v)
+constexpr std::uint32_t encode(PageOffset<size, shift_amount> v)
 {
     static_assert(std::popcount(splat) == size);
 
-    const auto encode_fn = [](std::ptrdiff_t current_offset, std::ptrdiff_t target_offset) {
-        return pdep<splat>(PageOffset<size, shift_amount>::encode(static_cast<std::uintptr_t>(current_offset), static_cast<std::uintptr_t>(target_offset)));
-    };
+    if (v.m_payload.kind == detail::OffsetPayload::Kind::Label) {
+        Label* label = v.m_payload.label;
+        if (label->m_offset) {
+            // A page offset between two labels depends on where the code is placed, unless it is placed page-aligned.
+            if (shift_amount != 0 && m_relocation_recording)
+                add_relocation(RelocationKind::Adrp, true, static_cast<std::uint64_t>(*label->m_offset));
+            return pdep<splat>(PageOffset<size, shift_amount>::encode(static_cast<std::uintptr_t>(Policy::offset()), static_cast<std::uintptr_t>(*label->m_offset)));
+        }
+        add_fixup(*label, page_fixup_kind<size, shift_amount>());
+        return 0u;
+    }
+    if (m_relocation_recording) {
+        add_relocation(shift_amount == 0 ? RelocationKind::Adr : RelocationKind::Adrp, false, reinterpret_cast<std::uintptr_t>(v.m_payload.ptr));
+        return 0u;
+    }
+    return pdep<splat>(PageOffset<size, shift_amount>::encode(Policy::template xptr<std::uintptr_t>(), reinterpret_cast<std::ptrdiff_t>(v.m_payload.ptr)));
+}
+
+constexpr void apply_fixup(const detail::Fixup& fixup, std::ptrdiff_t target_offset)
+{
+    constexpr std::uint32_t imm26_mask = 0x03FF'FFFF;
+    constexpr std::uint32_t imm19_mask = 0x00FF'FFE0;
+    constexpr std::uint32_t imm14_mask = 0x0007'FFE0;
+    constexpr std::uint32_t adr_mask = 0x60FF'FFE0;
 
-    return std::visit(detail::overloaded{
-                          [&](Label* label) -> std::uint32_t {
-                              if (label->m_offset) {
-                                  return encode_fn(Policy::offset(), *label->m_offset);
-                              }
+    const std::ptrdiff_t diff = target_offset - fixup.offset;
 
-                              label->m_wbs.emplace_back(Label::Writeback{Policy::offset(), ~splat, static_cast<Label::EmitFunctionType>(encode_fn)});
-                              return 0u;
-                          },
-                          [&](const void* p) -> std::uint32_t {
-                              return pdep<splat>(PageOffset<size, shift_amount>::encode(Policy::template xptr<std::uintptr_t>(), reinterpret_cast<std::ptrdiff_t>(p)));
-                          },
-                      },
-                      v.m_payload);
+    switch (fixup.kind) {
+    case detail::FixupKind::Imm26:
+        return Policy::set_at_offset(fixup.offset, pdep<imm26_mask>(AddrOffset<28, 2>::encode(diff)), ~imm26_mask);
+    case detail::FixupKind::Imm19:
+        return Policy::set_at_offset(fixup.offset, pdep<imm19_mask>(AddrOffset<21, 2>::encode(diff)), ~imm19_mask);
+    case detail::FixupKind::Imm14:
+        return Policy::set_at_offset(fixup.offset, pdep<imm14_mask>(AddrOffset<16, 2>::encode(diff)), ~imm14_mask);
+    case detail::FixupKind::Adr:
+        return Policy::set_at_offset(fixup.offset, pdep<adr_mask>(PageOffset<21, 0>::encode(static_cast<std::uintptr_t>(fixup.offset), static_cast<std::uintptr_t>(target_offset))), ~adr_mask);
+    case detail::FixupKind::Adrp:
+        if (m_relocation_recording)
+            m_relocations.push_back(Relocation{fixup.offset, RelocationKind::Adrp, true, static_cast<std::uint64_t>(target_offset)});
+        return Policy::set_at_offset(fixup.offset, pdep<adr_mask>(PageOffset<21, 12>::encode(static_cast<std::uintptr_t>(fixup.offset), static_cast<std::uintptr_t>(target_offset))), ~adr_mask);
+    case detail::FixupKind::Abs64: {
+        if (m_relocation_recording)
+            m_relocations.push_back(Relocation{fixup.offset, RelocationKind::Abs64, true, static_cast<std::uint64_t>(target_offset)});
+        const std::uint64_t addr = Policy::template xptr<std::uintptr_t>() - Policy::offset() + target_offset;
+        Policy::set_at_offset(fixup.offset, static_cast<std::uint32_t>(addr), 0);
+        return Policy::set_at_offset(fixup.offset + 4, static_cast<std::uint32_t>(addr >> 32), 0);
+    }
+    }
 }
 
 #undef OAKNUT_STD_ENCODE
 
-void addsubext_lsl_correction(AddSubExt& ext, XRegSp)
+constexpr void addsubext_lsl_correction(AddSubExt& ext, XRegSp)
 {
     if (ext == AddSubExt::LSL)
         ext = AddSubExt::UXTX;
 }
-void addsubext_lsl_correction(AddSubExt& ext, WRegWsp)
+constexpr void addsubext_lsl_correction(AddSubExt& ext, WRegWsp)
 {
     if (ext == AddSubExt::LSL)
         ext = AddSubExt::UXTW;
 }
-void addsubext_lsl_correction(AddSubExt& ext, XReg)
+constexpr void addsubext_lsl_correction(AddSubExt& ext, XReg)
 {
     if (ext == AddSubExt::LSL)
         ext = AddSubExt::UXTX;
 }
-void addsubext_lsl_correction(AddSubExt& ext, WReg)
+constexpr void addsubext_lsl_correction(AddSubExt& ext, WReg)
 {
     if (ext == AddSubExt::LSL)
         ext = AddSubExt::UXTW;
 }
 
-void addsubext_verify_reg_size(AddSubExt ext, RReg rm)
+constexpr void addsubext_verify_reg_size(AddSubExt ext, RReg rm)
 {
     if (rm.bitsize() == 32 && (static_cast<int>(ext) & 0b011) != 0b011)
         return;
     if (rm.bitsize() == 64 && (static_cast<int>(ext) & 0b011) == 0b011)
         return;
-    throw OaknutException{ExceptionType::InvalidAddSubExt};
+    detail::report_error(ExceptionType::InvalidAddSubExt);
 }
 
-void indexext_verify_reg_size(IndexExt ext, RReg rm)
+constexpr void indexext_verify_reg_size(IndexExt ext, RReg rm)
 {
     if (rm.bitsize() == 32 && (static_cast<int>(ext) & 1) == 0)
         return;
     if (rm.bitsize() == 64 && (static_cast<int>(ext) & 1) == 1)
         return;
-    throw OaknutException{ExceptionType::InvalidIndexExt};
+    detail::report_error(ExceptionType::InvalidIndexExt);
 }
 
-void tbz_verify_reg_size(RReg rt, Imm<6> imm)
+constexpr void tbz_verify_reg_size(RReg rt, Imm<6> imm)
 {
     if (rt.bitsize() == 32 && imm.value() >= 32)
-        throw OaknutException{ExceptionType::BitPositionOutOfRange};
+        detail::report_error(ExceptionType::BitPositionOutOfRange);
 }
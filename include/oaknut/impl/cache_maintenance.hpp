@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#elif defined(__APPLE__)
+#    include <libkern/OSCacheControl.h>
+#elif defined(__linux__) && __has_include(<linux/membarrier.h>)
+#    include <linux/membarrier.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    define OAKNUT_HAS_MEMBARRIER
+#endif
+
+#include "oaknut/impl/dirty_ranges.hpp"
+
+namespace oaknut::detail {
+
+// Cache properties relevant to making written instructions visible, as reported by CTR_EL0.
+struct CacheGeometry {
+    std::size_t icache_line;  // smallest instruction cache line, in bytes
+    std::size_t dcache_line;  // smallest data cache line, in bytes
+    bool idc;                 // data cache clean to the point of unification is not required
+    bool dic;                 // instruction cache invalidation to the point of unification is not required
+};
+
+constexpr CacheGeometry decode_ctr_el0(std::uint64_t ctr)
+{
+    return CacheGeometry{
+        std::size_t{4} << ((ctr >> 0) & 0xf),
+        std::size_t{4} << ((ctr >> 16) & 0xf),
+        ((ctr >> 28) & 1) != 0,
+        ((ctr >> 29) & 1) != 0,
+    };
+}
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+
+inline CacheGeometry read_cache_geometry()
+{
+    std::uint64_t ctr;
+    __asm__ volatile("mrs %0, ctr_el0"
+                     : "=r"(ctr));
+    return decode_ctr_el0(ctr);
+}
+
+#    if defined(__linux__)
+
+// Read once: Linux reports a sanitized CTR_EL0 to userspace, with the most conservative values of all cores.
+inline CacheGeometry cache_geometry()
+{
+    static const CacheGeometry geometry = read_cache_geometry();
+    return geometry;
+}
+
+#    else
+
+// Elsewhere CTR_EL0 may be read from the current core, so it is read again each time and the most conservative values
+// seen so far are kept, as a thread may migrate between cores whose caches differ.
+inline CacheGeometry cache_geometry()
+{
+    static CacheGeometry seen = read_cache_geometry();
+
+    const CacheGeometry current = read_cache_geometry();
+    seen = CacheGeometry{
+        std::min(seen.icache_line, current.icache_line),
+        std::min(seen.dcache_line, current.dcache_line),
+        seen.idc && current.idc,
+        seen.dic && current.dic,
+    };
+    return seen;
+}
+
+#    endif
+
+inline void clean_dcache_line(std::uintptr_t addr)
+{
+    __asm__ volatile("dc cvau, %0"
+                     :
+                     : "r"(addr)
+                     : "memory");
+}
+
+inline void invalidate_icache_line(std::uintptr_t addr)
+{
+    __asm__ volatile("ic ivau, %0"
+                     :
+                     : "r"(addr)
+                     : "memory");
+}
+
+inline void dsb_ish()
+{
+    __asm__ volatile("dsb ish\n"
+                     :
+                     :
+                     : "memory");
+}
+
+inline void isb()
+{
+    __asm__ volatile("isb\n"
+                     :
+                     :
+                     : "memory");
+}
+
+#endif
+
+// Makes instructions written to the given ranges of executable addresses visible to instruction fetch on all cores.
+// All ranges share one set of barriers, and the cache maintenance that CTR_EL0.IDC and CTR_EL0.DIC report to be
+// unnecessary is skipped; ranges should be normalized (see DirtyRanges::normalize) so that no line is
+// maintained twice.
+inline void invalidate_icache(std::span<const DirtyRange> ranges)
+{
+#if defined(__APPLE__)
+    for (const DirtyRange& range : ranges)
+        sys_icache_invalidate(reinterpret_cast<void*>(range.begin), range.end - range.begin);
+#elif defined(_WIN32)
+    for (const DirtyRange& range : ranges)
+        FlushInstructionCache(GetCurrentProcess(), reinterpret_cast<void*>(range.begin), range.end - range.begin);
+#else
+    if (ranges.empty())
+        return;
+
+    const CacheGeometry geometry = cache_geometry();
+
+    if (!geometry.idc) {
+        for (const DirtyRange& range : ranges) {
+            for (std::uintptr_t addr = range.begin & ~(geometry.dcache_line - 1); addr < range.end; addr += geometry.dcache_line)
+                clean_dcache_line(addr);
+        }
+    }
+    dsb_ish();
+
+    if (!geometry.dic) {
+        for (const DirtyRange& range : ranges) {
+            for (std::uintptr_t addr = range.begin & ~(geometry.icache_line - 1); addr < range.end; addr += geometry.icache_line)
+                invalidate_icache_line(addr);
+        }
+        dsb_ish();
+    }
+    isb();
+#endif
+}
+
+// Makes instructions written to [mem, mem + size) visible to instruction fetch on all cores.
+// mem is the executable address of the instructions.
+inline void invalidate_icache(void* mem, std::size_t size)
+{
+    const DirtyRange range{reinterpret_cast<std::uintptr_t>(mem), reinterpret_cast<std::uintptr_t>(mem) + size};
+    invalidate_icache(std::span{&range, 1});
+}
+
+// Makes every thread of the process perform a context synchronization event, so that threads other than the caller
+// may execute instructions made visible by invalidate_icache without first executing an ISB themselves.
+// Uses membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE) on Linux 4.16 and later; the process is registered for
+// it on first use. Returns false where this is unavailable, in which case each other thread must execute an ISB
+// (or another context synchronization event, such as a system call) before running new code.
+inline bool synchronize_all_threads()
+{
+#if defined(OAKNUT_HAS_MEMBARRIER)
+    static const bool registered = [] {
+        const long supported = syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0, 0);
+        return supported >= 0
+               && (supported & MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE) != 0
+               && syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED_SYNC_CORE, 0, 0) == 0;
+    }();
+    return registered && syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE, 0, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace oaknut::detail
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <unistd.h>
+#endif
+
+#include "oaknut/oaknut_exception.hpp"
+
+namespace oaknut {
+
+enum class HugePages {
+    None,
+    // Aligns the block to the huge page size and advises the kernel to back it with transparent huge pages
+    // (MADV_HUGEPAGE). Linux only.
+    Transparent,
+    // Allocates the block from the hugetlbfs pool (MAP_HUGETLB, or MFD_HUGETLB for DualCodeBlock), falling back to
+    // Transparent if the pool is exhausted. Linux only.
+    Explicit,
+};
+
+// Distances for CodeBlockOptions::near_distance: from anywhere in the block, BL and B reach near_branch_range bytes,
+// and ADRP (and so ADRL and a short MOVP2R) reaches near_adrp_range bytes.
+inline constexpr std::size_t near_branch_range = (std::size_t{1} << 27) - 4;
+inline constexpr std::size_t near_adrp_range = (std::size_t{1} << 32) - 4096;
+
+// Allocation options for CodeBlock and DualCodeBlock. Sizes are always rounded up to the runtime page size, or to the
+// huge page size if huge pages are requested on Linux.
+struct CodeBlockOptions {
+    HugePages huge_pages = HugePages::None;
+    // Fault in all pages on allocation (MAP_POPULATE) rather than on first write. Linux only.
+    bool prefault = false;
+    // If set, the block (its executable mirror, for DualCodeBlock) is placed so that all of it lies within
+    // near_distance bytes of near, for example a function in the host's text segment, so that code in the block
+    // can reach it directly. This is best effort: if no free range is found, the block is placed anywhere.
+    // Not supported by DualCodeBlock on Apple platforms.
+    const void* near = nullptr;
+    std::size_t near_distance = near_branch_range;
+};
+
+namespace detail {
+
+inline std::size_t page_size()
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+#else
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#endif
+}
+
+// Size of a block mapped by one level-2 translation table entry: 2 MiB with 4 KiB pages, 32 MiB with 16 KiB pages,
+// and 512 MiB with 64 KiB pages.
+inline std::size_t huge_page_size()
+{
+    return page_size() * (page_size() / 8);
+}
+
+// Huge pages as requested by options on Linux, and HugePages::None elsewhere, where they are ignored.
+inline HugePages huge_pages(const CodeBlockOptions& options)
+{
+#if defined(__linux__)
+    return options.huge_pages;
+#else
+    (void)options;
+    return HugePages::None;
+#endif
+}
+
+// Throws std::bad_alloc, or without exception support reports CodeBlockAllocationFailed.
+OAKNUT_COLD inline void report_allocation_failure()
+{
+#if defined(OAKNUT_NO_EXCEPTIONS)
+    report_error(ExceptionType::CodeBlockAllocationFailed);
+#else
+    throw std::bad_alloc{};
+#endif
+}
+
+inline std::size_t allocation_size(std::size_t size, const CodeBlockOptions& options)
+{
+    const std::size_t granule = huge_pages(options) == HugePages::None ? page_size() : huge_page_size();
+    return (size + granule - 1) / granule * granule;
+}
+
+// Probes start addresses, aligned to alignment, from closest to farthest from options.near (alternating above and
+// below it) for which all of [start, start + size) lies within options.near_distance of it. try_map(hint) maps size
+// bytes exactly at hint, or returns nullptr. Returns the first successful mapping, or nullptr.
+template<typename F>
+void* map_near(const CodeBlockOptions& options, std::size_t size, std::size_t alignment, F&& try_map)
+{
+    constexpr std::size_t min_step = std::size_t{1} << 20;
+
+    const auto target = reinterpret_cast<std::uintptr_t>(options.near);
+    if (size > options.near_distance || target < size)
+        return nullptr;
+
+    const std::size_t step = (std::max(min_step, alignment) + alignment - 1) / alignment * alignment;
+    const std::uintptr_t lowest = target > options.near_distance ? target - options.near_distance : alignment;
+    const std::uintptr_t highest = target + options.near_distance - size;
+
+    std::uintptr_t up = (target + alignment - 1) / alignment * alignment;
+    std::uintptr_t down = (target - size) / alignment * alignment;
+    bool search_up = up <= highest, search_down = down >= lowest;
+    while (search_up || search_down) {
+        if (search_up) {
+            if (void* memory = try_map(reinterpret_cast<void*>(up)))
+                return memory;
+            up += step;
+            search_up = up <= highest;
+        }
+        if (search_down) {
+            if (void* memory = try_map(reinterpret_cast<void*>(down)))
+                return memory;
+            search_down = down >= lowest + step;
+            down -= step;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace detail
+
+}  // namespace oaknut
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace oaknut {
+
+// A range [begin, end) of executable addresses.
+struct DirtyRange {
+    std::uintptr_t begin;
+    std::uintptr_t end;
+
+    bool operator==(const DirtyRange&) const = default;
+};
+
+// Executable address ranges that have been written and need invalidating, for CodeBlock::invalidate and
+// DualCodeBlock::invalidate. Ranges that extend the most recent one are merged as they are added.
+class DirtyRanges {
+public:
+    void add(std::uintptr_t begin, std::uintptr_t end)
+    {
+        if (begin == end)
+            return;
+        if (!m_ranges.empty() && begin <= m_ranges.back().end && end >= m_ranges.back().begin) {
+            m_ranges.back().begin = std::min(m_ranges.back().begin, begin);
+            m_ranges.back().end = std::max(m_ranges.back().end, end);
+            return;
+        }
+        m_ranges.push_back(DirtyRange{begin, end});
+    }
+
+    void add(const void* begin, std::size_t size)
+    {
+        const auto addr = reinterpret_cast<std::uintptr_t>(begin);
+        add(addr, addr + size);
+    }
+
+    // Sorts the ranges and merges those that overlap or are adjacent.
+    void normalize()
+    {
+        if (m_ranges.size() < 2)
+            return;
+
+        std::sort(m_ranges.begin(), m_ranges.end(), [](const DirtyRange& a, const DirtyRange& b) { return a.begin < b.begin; });
+
+        auto out = m_ranges.begin();
+        for (auto iter = m_ranges.begin() + 1; iter != m_ranges.end(); ++iter) {
+            if (iter->begin <= out->end)
+                out->end = std::max(out->end, iter->end);
+            else
+                *++out = *iter;
+        }
+        m_ranges.erase(out + 1, m_ranges.end());
+    }
+
+    std::span<const DirtyRange> ranges() const
+    {
+        return m_ranges;
+    }
+
+    bool empty() const
+    {
+        return m_ranges.empty();
+    }
+
+    void clear()
+    {
+        m_ranges.clear();
+    }
+
+private:
+    std::vector<DirtyRange> m_ranges;
+};
+
+}  // namespace oaknut
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oaknut::detail {
+
+enum class FixupKind : std::uint8_t {
+    Imm26,  // B, BL
+    Imm19,  // B.cond, CBZ, CBNZ, LDR (literal), LDRSW (literal), PRFM (literal)
+    Imm14,  // TBZ, TBNZ
+    Adr,    // ADR
+    Adrp,   // ADRP
+    Abs64,  // dx(Label&)
+};
+
+struct Fixup {
+    std::ptrdiff_t offset;
+    FixupKind kind;
+};
+
+/// Largest forward displacement (in bytes) reachable by a fixup of a short-range branch kind, or 0 otherwise.
+constexpr std::ptrdiff_t max_short_branch_offset(FixupKind kind)
+{
+    switch (kind) {
+    case FixupKind::Imm19:
+        return (std::ptrdiff_t{1} << 20) - 4;
+    case FixupKind::Imm14:
+        return (std::ptrdiff_t{1} << 15) - 4;
+    default:
+        return 0;
+    }
+}
+
+/// B.cond, CBZ, CBNZ, TBZ or TBNZ
+constexpr bool is_short_branch(std::uint32_t instruction)
+{
+    return (instruction & 0xFF00'0010) == 0x5400'0000 || (instruction & 0x7C00'0000) == 0x3400'0000;
+}
+
+/// B.AL or B.NV
+constexpr bool is_unconditional_short_branch(std::uint32_t instruction)
+{
+    return (instruction & 0xFF00'001E) == 0x5400'000E;
+}
+
+/// Inverts the condition of a short branch: B.cond <-> B.!cond, CBZ <-> CBNZ, TBZ <-> TBNZ.
+constexpr std::uint32_t invert_short_branch(std::uint32_t instruction)
+{
+    if ((instruction & 0xFF00'0010) == 0x5400'0000)
+        return instruction ^ 1;
+    return instruction ^ (1 << 24);
+}
+
+// Pending label references, owned by a code generator.
+// Each unbound label that has been referenced holds a handle to an entry in this table.
+// An entry stores its first two fixups inline; further fixups are chained through a node pool.
+// Released entries and nodes are recycled, so once the table has warmed up no allocation occurs.
+class FixupTable {
+public:
+    static constexpr std::uint32_t npos = ~std::uint32_t{0};
+
+    constexpr std::uint32_t acquire()
+    {
+        if (m_free_entries != npos) {
+            const std::uint32_t handle = m_free_entries;
+            m_free_entries = m_entries[handle].next;
+            m_entries[handle] = Entry{};
+            return handle;
+        }
+        m_entries.emplace_back();
+        return static_cast<std::uint32_t>(m_entries.size() - 1);
+    }
+
+    constexpr void add(std::uint32_t handle, Fixup fixup)
+    {
+        Entry& entry = m_entries[handle];
+        if (entry.count < inline_capacity) {
+            entry.fixups[entry.count++] = fixup;
+            return;
+        }
+
+        std::uint32_t node;
+        if (m_free_nodes != npos) {
+            node = m_free_nodes;
+            m_free_nodes = m_nodes[node].next;
+        } else {
+            m_nodes.emplace_back();
+            node = static_cast<std::uint32_t>(m_nodes.size() - 1);
+        }
+        m_nodes[node] = Node{fixup, entry.next};
+        entry.next = node;
+    }
+
+    /// Calls fn on each fixup of handle. fn may modify the fixup.
+    template<typename F>
+    constexpr void for_each(std::uint32_t handle, F&& fn)
+    {
+        Entry& entry = m_entries[handle];
+        for (std::uint32_t i = 0; i < entry.count; i++)
+            fn(entry.fixups[i]);
+        for (std::uint32_t node = entry.next; node != npos; node = m_nodes[node].next)
+            fn(m_nodes[node].fixup);
+    }
+
+    /// Calls fn on each fixup of every handle that is currently in use. fn may modify the fixup.
+    template<typename F>
+    constexpr void for_each_pending(F&& fn)
+    {
+        for (std::uint32_t handle = 0; handle < m_entries.size(); handle++) {
+            if (m_entries[handle].count != 0)
+                for_each(handle, fn);
+        }
+    }
+
+    /// Returns handle and its overflow nodes to the free lists.
+    constexpr void release(std::uint32_t handle)
+    {
+        Entry& entry = m_entries[handle];
+        std::uint32_t node = entry.next;
+        while (node != npos) {
+            const std::uint32_t next = m_nodes[node].next;
+            m_nodes[node].next = m_free_nodes;
+            m_free_nodes = node;
+            node = next;
+        }
+        entry.count = 0;
+        entry.next = m_free_entries;
+        m_free_entries = handle;
+    }
+
+private:
+    static constexpr std::uint32_t inline_capacity = 2;
+
+    struct Entry {
+        Fixup fixups[inline_capacity]{};
+        std::uint32_t count = 0;
+        std::uint32_t next = npos;  // first overflow node while in use, next free entry once released
+    };
+
+    struct Node {
+        Fixup fixup;
+        std::uint32_t next = npos;
+    };
+
+    std::vector<Entry> m_entries;
+    std::vector<Node> m_nodes;
+    std::uint32_t m_free_entries = npos;
+    std::uint32_t m_free_nodes = npos;
+};
+
+}  // namespace oaknut::detail
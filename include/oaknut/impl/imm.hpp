@@ -24,7 +24,7 @@ public:
         : m_value(value_)
     {
         if (!is_valid(value_))
-            throw OaknutException{ExceptionType::ImmOutOfRange};
+            detail::report_error(ExceptionType::ImmOutOfRange);
     }
 
     constexpr auto operator<=>(const Imm& other) const { return m_value <=> other.m_value; }
@@ -32,7 +32,7 @@ public:
 
     constexpr std::uint32_t value() const { return m_value; }
 
-    static bool is_valid(std::uint32_t value_)
+    static constexpr bool is_valid(std::uint32_t value_)
     {
         return ((value_ & mask) == value_);
     }
@@ -54,7 +54,7 @@ public:
         : m_encoded(value_ | ((shift_ == AddSubImmShift::SHL_12) ? 1 << 12 : 0))
     {
         if ((value_ & 0xFFF) != value_)
-            throw OaknutException{ExceptionType::InvalidAddSubImm};
+            detail::report_error(ExceptionType::InvalidAddSubImm);
     }
 
     constexpr /* implicit */ AddSubImm(std::uint64_t value_)
@@ -64,7 +64,7 @@ public:
         } else if ((value_ & 0xFFF000) == value_) {
             m_encoded = static_cast<std::uint32_t>((value_ >> 12) | (1 << 12));
         } else {
-            throw OaknutException{ExceptionType::InvalidAddSubImm};
+            detail::report_error(ExceptionType::InvalidAddSubImm);
         }
     }
 
@@ -76,7 +76,7 @@ public:
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::uint32_t m_encoded;
+    std::uint32_t m_encoded = 0;
 };
 
 enum class MovImm16Shift {
@@ -88,7 +88,7 @@ enum class MovImm16Shift {
 
 struct MovImm16 {
 public:
-    MovImm16(std::uint16_t value_, MovImm16Shift shift_)
+    constexpr MovImm16(std::uint16_t value_, MovImm16Shift shift_)
         : m_encoded(static_cast<std::uint32_t>(value_) | (static_cast<std::uint32_t>(shift_) << 16))
     {}
 
@@ -101,7 +101,7 @@ public:
                 m_encoded = lsw | (shift << 16);
                 return;
             } else if (lsw != 0) {
-                throw OaknutException{ExceptionType::InvalidMovImm16};
+                detail::report_error(ExceptionType::InvalidMovImm16);
             }
             value_ >>= 16;
             shift++;
@@ -151,6 +151,37 @@ constexpr std::optional<std::uint32_t> encode_bit_imm(std::uint32_t value)
     return result;
 }
 
+// imm8 of FMOV (immediate) for the single-precision bit pattern value
+constexpr std::optional<std::uint8_t> encode_fp_imm8(std::uint32_t value)
+{
+    const std::uint32_t exponent = (value >> 25) & 0x3F;
+    if ((value & 0x7FFFF) != 0 || (exponent != 0x20 && exponent != 0x1F))
+        return std::nullopt;
+    return static_cast<std::uint8_t>(((value >> 24) & 0x80) | ((value >> 19) & 0x7F));
+}
+
+// imm8 of FMOV (immediate) for the double-precision bit pattern value
+constexpr std::optional<std::uint8_t> encode_fp_imm8(std::uint64_t value)
+{
+    const std::uint64_t exponent = (value >> 54) & 0x1FF;
+    if ((value & 0xFFFF'FFFF'FFFF) != 0 || (exponent != 0x100 && exponent != 0x0FF))
+        return std::nullopt;
+    return static_cast<std::uint8_t>(((value >> 56) & 0x80) | ((value >> 48) & 0x7F));
+}
+
+// imm8 of MOVI (64-bit variants): each bit selects whether the corresponding byte is all-ones
+constexpr std::optional<std::uint8_t> encode_rep_imm(std::uint64_t value)
+{
+    std::uint8_t result = 0;
+    for (int i = 0; i < 8; i++) {
+        const std::uint8_t byte = static_cast<std::uint8_t>(value >> (8 * i));
+        if (byte != 0x00 && byte != 0xFF)
+            return std::nullopt;
+        result |= (byte & 1) << i;
+    }
+    return result;
+}
+
 }  // namespace detail
 
 struct BitImm32 {
@@ -162,15 +193,17 @@ public:
     constexpr /* implicit */ BitImm32(std::uint32_t value)
     {
         const auto encoded = detail::encode_bit_imm(value);
-        if (!encoded || (*encoded & 0x1000) != 0)
-            throw OaknutException{ExceptionType::InvalidBitImm32};
+        if (!encoded || (*encoded & 0x1000) != 0) {
+            detail::report_error(ExceptionType::InvalidBitImm32);
+            return;
+        }
         m_encoded = *encoded;
     }
 
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::uint32_t m_encoded;
+    std::uint32_t m_encoded = 0;
 };
 
 struct BitImm64 {
@@ -182,15 +215,17 @@ public:
     constexpr /* implicit */ BitImm64(std::uint64_t value)
     {
         const auto encoded = detail::encode_bit_imm(value);
-        if (!encoded)
-            throw OaknutException{ExceptionType::InvalidBitImm64};
+        if (!encoded) {
+            detail::report_error(ExceptionType::InvalidBitImm64);
+            return;
+        }
         m_encoded = *encoded;
     }
 
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::uint32_t m_encoded;
+    std::uint32_t m_encoded = 0;
 };
 
 struct FImm8 {
@@ -226,7 +261,7 @@ struct ImmConst {
     constexpr /* implicit */ ImmConst(int value)
     {
         if (value != A) {
-            throw OaknutException{ExceptionType::InvalidImmConst};
+            detail::report_error(ExceptionType::InvalidImmConst);
         }
     }
 };
@@ -235,7 +270,7 @@ struct ImmConstFZero {
     constexpr /* implicit */ ImmConstFZero(double value)
     {
         if (value != 0) {
-            throw OaknutException{ExceptionType::InvalidImmConstFZero};
+            detail::report_error(ExceptionType::InvalidImmConstFZero);
         }
     }
 };
@@ -252,14 +287,14 @@ struct ImmChoice<A, B> {
         } else if (value == B) {
             m_encoded = 1;
         } else {
-            throw OaknutException{ExceptionType::InvalidImmChoice};
+            detail::report_error(ExceptionType::InvalidImmChoice);
         }
     }
 
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::uint32_t m_encoded;
+    std::uint32_t m_encoded = 0;
 };
 
 template<int A, int B, int C, int D>
@@ -275,14 +310,14 @@ struct ImmChoice<A, B, C, D> {
         } else if (value == D) {
             m_encoded = 3;
         } else {
-            throw OaknutException{ExceptionType::InvalidImmChoice};
+            detail::report_error(ExceptionType::InvalidImmChoice);
         }
     }
 
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::uint32_t m_encoded;
+    std::uint32_t m_encoded = 0;
 };
 
 template<unsigned Start, unsigned End>
@@ -291,7 +326,7 @@ struct ImmRange {
         : m_value(value_)
     {
         if (value_ < Start || value_ > End) {
-            throw OaknutException{ExceptionType::InvalidImmRange};
+            detail::report_error(ExceptionType::InvalidImmRange);
         }
     }
 
@@ -307,7 +342,7 @@ struct LslShift {
         : m_encoded((((-amount) & (max_value - 1)) << 6) | (max_value - amount - 1))
     {
         if (amount >= max_value)
-            throw OaknutException{ExceptionType::LslShiftOutOfRange};
+            detail::report_error(ExceptionType::LslShiftOutOfRange);
     }
 
 private:
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oaknut::detail {
+
+struct Literal {
+    std::uint64_t lo;
+    std::uint64_t hi;
+    bool wide;  // 128-bit
+
+    constexpr bool operator==(const Literal&) const = default;
+
+    constexpr std::size_t size() const
+    {
+        return wide ? 16 : 8;
+    }
+};
+
+struct LiteralHash {
+    constexpr std::size_t operator()(const Literal& literal) const
+    {
+        const std::uint64_t h = (literal.lo * 0x9E37'79B9'7F4A'7C15) ^ ((literal.hi + literal.wide) * 0xC2B2'AE3D'27D4'EB4F);
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+};
+
+// Constants awaiting emission, owned by a code generator.
+// Each distinct constant is stored once; its index identifies it until the pool is cleared.
+// Lookup is by an open-addressed (linear probing) table of indices, so the pool is usable in constant evaluation.
+class LiteralPool {
+public:
+    /// Returns the index of literal, adding it to the pool if it is not already present.
+    constexpr std::size_t insert(const Literal& literal)
+    {
+        if ((m_literals.size() + 1) * 2 > m_slots.size())
+            grow();
+
+        std::size_t& slot = m_slots[find_slot(literal)];
+        if (slot != 0)
+            return slot - 1;
+
+        m_literals.push_back(literal);
+        m_size += literal.size();
+        m_has_wide |= literal.wide;
+        slot = m_literals.size();
+        return slot - 1;
+    }
+
+    constexpr bool empty() const
+    {
+        return m_literals.empty();
+    }
+
+    /// Total size of the constants, excluding any alignment padding.
+    constexpr std::size_t size_in_bytes() const
+    {
+        return m_size;
+    }
+
+    constexpr bool has_wide() const
+    {
+        return m_has_wide;
+    }
+
+    constexpr const std::vector<Literal>& literals() const
+    {
+        return m_literals;
+    }
+
+    constexpr void clear()
+    {
+        // In reverse order of insertion, so that no probe sequence is cut short by an already emptied slot.
+        for (std::size_t i = m_literals.size(); i-- > 0;)
+            m_slots[find_slot(m_literals[i])] = 0;
+        m_literals.clear();
+        m_size = 0;
+        m_has_wide = false;
+    }
+
+private:
+    // Index of the slot holding literal, or of the empty slot where it would be inserted.
+    constexpr std::size_t find_slot(const Literal& literal) const
+    {
+        const std::size_t mask = m_slots.size() - 1;
+        std::size_t i = LiteralHash{}(literal) & mask;
+        while (m_slots[i] != 0 && m_literals[m_slots[i] - 1] != literal)
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    constexpr void grow()
+    {
+        m_slots.assign(m_slots.empty() ? 16 : m_slots.size() * 2, 0);
+        for (std::size_t i = 0; i < m_literals.size(); i++)
+            m_slots[find_slot(m_literals[i])] = i + 1;
+    }
+
+    std::vector<std::size_t> m_slots;  // power-of-two sized; each is 0 if empty, else one plus an index into m_literals
+    std::vector<Literal> m_literals;
+    std::size_t m_size = 0;
+    bool m_has_wide = false;
+};
+
+}  // namespace oaknut::detail
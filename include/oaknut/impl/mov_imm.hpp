@@ -0,0 +1,264 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "oaknut/impl/imm.hpp"
+
+namespace oaknut {
+
+namespace detail {
+
+// A plan for materializing a 64-bit immediate: one base instruction producing `value`,
+// followed by a MOVK for each halfword in which `value` differs from the immediate.
+// Dup32 instead materializes the low word as MOV (32-bit) does and copies it to the high word with ORR.
+struct MovPlan {
+    enum class Base : std::uint8_t {
+        Movz,
+        Movn,
+        Movn32,
+        Orr,
+        Orr32,
+        Dup32,
+    };
+
+    Base base;
+    std::uint64_t value;
+    int cost;
+};
+
+constexpr std::uint16_t halfword(std::uint64_t value, int i)
+{
+    return static_cast<std::uint16_t>(value >> (16 * i));
+}
+
+constexpr int differing_halfwords(std::uint64_t a, std::uint64_t b)
+{
+    std::uint64_t x = a ^ b;
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    // Sums the four per-halfword flags into the top halfword.
+    return static_cast<int>(((x & 0x0001'0001'0001'0001) * 0x0001'0001'0001'0001) >> 48);
+}
+
+constexpr int mov_imm32_cost(std::uint32_t imm)
+{
+    if (MovImm16::is_valid(imm) || MovImm16::is_valid(static_cast<std::uint32_t>(~imm)) || encode_bit_imm(imm))
+        return 1;
+    return 2;
+}
+
+/// Finds a shortest instruction sequence for MOV (64-bit immediate).
+/// Considers MOVZ, MOVN (64- and 32-bit) and ORR bitmask immediates (64- and 32-bit) each followed by MOVKs,
+/// as well as duplicating a 32-bit value into both words.
+constexpr MovPlan plan_mov_imm64(std::uint64_t imm)
+{
+    int lowest_nonzero = 0, lowest_nonones = 0;
+    while (lowest_nonzero < 3 && halfword(imm, lowest_nonzero) == 0)
+        lowest_nonzero++;
+    while (lowest_nonones < 3 && halfword(imm, lowest_nonones) == 0xFFFF)
+        lowest_nonones++;
+
+    const std::uint64_t movz_value = imm & (std::uint64_t{0xFFFF} << (16 * lowest_nonzero));
+    MovPlan best{MovPlan::Base::Movz, movz_value, 1 + differing_halfwords(imm, movz_value)};
+
+    const auto consider = [&](MovPlan::Base base, std::uint64_t value) {
+        const int cost = 1 + differing_halfwords(imm, value);
+        if (cost < best.cost)
+            best = MovPlan{base, value, cost};
+    };
+
+    consider(MovPlan::Base::Movn, imm | ~(std::uint64_t{0xFFFF} << (16 * lowest_nonones)));
+    if (best.cost == 1)
+        return best;
+    if (encode_bit_imm(imm))
+        return MovPlan{MovPlan::Base::Orr, imm, 1};
+    if ((imm >> 32) == 0 && encode_bit_imm(static_cast<std::uint32_t>(imm)))
+        return MovPlan{MovPlan::Base::Orr32, imm, 1};
+
+    const int low_nonones = halfword(imm, 0) == 0xFFFF ? 1 : 0;
+    consider(MovPlan::Base::Movn32, 0xFFFF'FFFF & (imm | ~(std::uint64_t{0xFFFF} << (16 * low_nonones))));
+
+    if (halfword(imm, 0) == halfword(imm, 2) && halfword(imm, 1) == halfword(imm, 3)) {
+        const int cost = mov_imm32_cost(static_cast<std::uint32_t>(imm)) + 1;
+        if (cost < best.cost)
+            best = MovPlan{MovPlan::Base::Dup32, imm, cost};
+    }
+
+    if (best.cost <= 2)
+        return best;
+
+    // Bitmask immediates that agree with imm in enough halfwords to be an improvement.
+    // Halfwords overwritten by MOVK only need to keep the candidate encodable: for a run of ones, filling them
+    // with all-zeros or all-ones merely moves the ends of the run. Shorter elements replicate a halfword or word.
+    const auto consider_orr = [&](std::uint64_t value) {
+        if (1 + differing_halfwords(imm, value) < best.cost && encode_bit_imm(value))
+            best = MovPlan{MovPlan::Base::Orr, value, 1 + differing_halfwords(imm, value)};
+    };
+    const auto consider_orr32 = [&](std::uint32_t value) {
+        if (1 + differing_halfwords(imm, value) < best.cost && encode_bit_imm(value))
+            best = MovPlan{MovPlan::Base::Orr32, value, 1 + differing_halfwords(imm, value)};
+    };
+
+    const std::uint16_t h[4] = {halfword(imm, 0), halfword(imm, 1), halfword(imm, 2), halfword(imm, 3)};
+
+    // Element size 64: only halfwords with at most two transitions can be part of a rotated run of ones.
+    unsigned runs = 0;
+    for (int i = 0; i < 4; i++) {
+        unsigned transitions = (h[i] ^ (h[i] >> 1)) & 0x7FFF;
+        transitions &= transitions - 1;
+        transitions &= transitions - 1;
+        if (transitions == 0)
+            runs |= 1u << i;
+    }
+    for (unsigned keep = runs; keep != 0; keep = (keep - 1) & runs) {
+        const int free = 4 - static_cast<int>((keep & 1) + ((keep >> 1) & 1) + ((keep >> 2) & 1) + (keep >> 3));
+        if (1 + free >= best.cost)
+            continue;
+        for (unsigned fill = 0; fill < (1u << free); fill++) {
+            std::uint64_t value = 0;
+            for (int i = 0, f = 0; i < 4; i++) {
+                const std::uint64_t v = (keep >> i) & 1 ? h[i] : ((fill >> f++) & 1) * 0xFFFF;
+                value |= v << (16 * i);
+            }
+            consider_orr(value);
+        }
+    }
+
+    // Element size 32: the halves of the element are halfwords of imm (with the same run constraint) or fills.
+    // Candidates made only of fills never beat MOVZ or MOVN, so at least one halfword of imm must be used.
+    if (runs != 0) {
+        std::uint16_t lows[4], highs[4];
+        int low_count = 0, high_count = 0;
+        for (int i = 0; i < 4; i++) {
+            if ((runs >> i) & 1)
+                (i % 2 == 0 ? lows[low_count++] : highs[high_count++]) = h[i];
+        }
+        for (const std::uint16_t fill : {std::uint16_t{0x0000}, std::uint16_t{0xFFFF}}) {
+            lows[low_count++] = fill;
+            highs[high_count++] = fill;
+        }
+        for (int i = 0; i < low_count; i++) {
+            for (int j = 0; j < high_count; j++) {
+                const std::uint32_t word = lows[i] | (static_cast<std::uint32_t>(highs[j]) << 16);
+                consider_orr(word * std::uint64_t{0x0000'0001'0000'0001});
+                consider_orr32(word);
+            }
+        }
+    }
+
+    // Element size 16 or less: every halfword is identical.
+    for (const std::uint16_t c : h) {
+        consider_orr(c * std::uint64_t{0x0001'0001'0001'0001});
+        consider_orr32(c * std::uint32_t{0x0001'0001});
+    }
+
+    return best;
+}
+
+// A plan for materializing a 64-bit pattern in each doubleword of a vector register using modified immediates.
+// imm and shift describe the first instruction; the combined kinds add an ORR or BIC described by imm2 and shift2.
+struct VectorMovPlan {
+    enum class Kind : std::uint8_t {
+        MoviRep,    // MOVI (64-bit)
+        Movi8,      // MOVI (8-bit)
+        Movi16,     // MOVI (16-bit, LSL)
+        Mvni16,     // MVNI (16-bit, LSL)
+        Movi32,     // MOVI (32-bit, LSL)
+        Mvni32,     // MVNI (32-bit, LSL)
+        Movi32Msl,  // MOVI (32-bit, MSL)
+        Mvni32Msl,  // MVNI (32-bit, MSL)
+        Fmov32,     // FMOV (vector, single-precision)
+        Fmov64,     // FMOV (vector, double-precision)
+        Movi16Orr,  // MOVI + ORR (16-bit, LSL)
+        Movi32Orr,  // MOVI + ORR (32-bit, LSL)
+        Mvni32Bic,  // MVNI + BIC (32-bit, LSL)
+        Literal,    // no sequence of at most two instructions
+    };
+
+    Kind kind;
+    std::uint8_t imm = 0;
+    int shift = 0;
+    std::uint8_t imm2 = 0;
+    int shift2 = 0;
+};
+
+/// Finds a sequence of at most two instructions producing imm in each doubleword of a vector register.
+constexpr VectorMovPlan plan_vector_mov(std::uint64_t imm)
+{
+    using Kind = VectorMovPlan::Kind;
+
+    if (const auto rep = encode_rep_imm(imm))
+        return {Kind::MoviRep, *rep};
+    if (const auto fp = encode_fp_imm8(imm))
+        return {Kind::Fmov64, *fp};
+
+    const std::uint32_t word = static_cast<std::uint32_t>(imm);
+    if ((imm >> 32) != word)
+        return {Kind::Literal};
+
+    const std::uint16_t hw = static_cast<std::uint16_t>(word);
+    if ((word >> 16) == hw) {
+        const std::uint8_t lo = static_cast<std::uint8_t>(hw), hi = static_cast<std::uint8_t>(hw >> 8);
+        if (lo == hi)
+            return {Kind::Movi8, lo};
+        if (hi == 0x00)
+            return {Kind::Movi16, lo, 0};
+        if (lo == 0x00)
+            return {Kind::Movi16, hi, 8};
+        if (hi == 0xFF)
+            return {Kind::Mvni16, static_cast<std::uint8_t>(~lo), 0};
+        if (lo == 0xFF)
+            return {Kind::Mvni16, static_cast<std::uint8_t>(~hi), 8};
+        return {Kind::Movi16Orr, lo, 0, hi, 8};
+    }
+
+    // Bytes of word that differ from all-zeros and from all-ones, in order of increasing significance.
+    int nonzero[4] = {}, nonones[4] = {};
+    int nonzero_count = 0, nonones_count = 0;
+    for (int i = 0; i < 4; i++) {
+        const std::uint8_t byte = static_cast<std::uint8_t>(word >> (8 * i));
+        if (byte != 0x00)
+            nonzero[nonzero_count++] = i;
+        if (byte != 0xFF)
+            nonones[nonones_count++] = i;
+    }
+    const auto byte = [&](int i) { return static_cast<std::uint8_t>(word >> (8 * i)); };
+    const auto inverted_byte = [&](int i) { return static_cast<std::uint8_t>(~word >> (8 * i)); };
+
+    if (nonzero_count == 1)
+        return {Kind::Movi32, byte(nonzero[0]), 8 * nonzero[0]};
+    if (nonones_count == 1)
+        return {Kind::Mvni32, inverted_byte(nonones[0]), 8 * nonones[0]};
+    if ((word & 0xFFFF'00FF) == 0x0000'00FF)
+        return {Kind::Movi32Msl, byte(1), 8};
+    if ((word & 0xFF00'FFFF) == 0x0000'FFFF)
+        return {Kind::Movi32Msl, byte(2), 16};
+    if ((~word & 0xFFFF'00FF) == 0x0000'00FF)
+        return {Kind::Mvni32Msl, inverted_byte(1), 8};
+    if ((~word & 0xFF00'FFFF) == 0x0000'FFFF)
+        return {Kind::Mvni32Msl, inverted_byte(2), 16};
+    if (const auto fp = encode_fp_imm8(word))
+        return {Kind::Fmov32, *fp};
+    if (nonzero_count == 2)
+        return {Kind::Movi32Orr, byte(nonzero[0]), 8 * nonzero[0], byte(nonzero[1]), 8 * nonzero[1]};
+    if (nonones_count == 2)
+        return {Kind::Mvni32Bic, inverted_byte(nonones[0]), 8 * nonones[0], inverted_byte(nonones[1]), 8 * nonones[1]};
+
+    return {Kind::Literal};
+}
+
+}  // namespace detail
+
+/// Number of instructions MOV (64-bit immediate) emits for imm.
+constexpr int materialize_cost(std::uint64_t imm)
+{
+    return detail::plan_mov_imm64(imm).cost;
+}
+
+}  // namespace oaknut
@@ -42,3 +42,25 @@ OAKNUT_EXCEPTION(InvalidRotation, "Invalid rotation operand")
 // oaknut.hpp
 OAKNUT_EXCEPTION(InvalidAlignment, "invalid alignment")
 OAKNUT_EXCEPTION(LabelRedefinition, "label already resolved")
+OAKNUT_EXCEPTION(LabelHasPendingReferences, "label with pending references cannot be copied or overwritten")
+OAKNUT_EXCEPTION(CodeBufferFull, "code buffer is full")
+OAKNUT_EXCEPTION(AssembledSizeMismatch, "assembled sequence does not have the declared size")
+OAKNUT_EXCEPTION(UnflushedLiterals, "literals are pending and must be emitted with flush_literals()")
+OAKNUT_EXCEPTION(InvalidStencilArgument, "stencil argument does not match its hole")
+
+// code_block.hpp, dual_code_block.hpp
+OAKNUT_EXCEPTION(CodeBlockAllocationFailed, "could not allocate memory for the code block")
+OAKNUT_EXCEPTION(UnsafePatch, "instruction cannot be patched while it may be executing")
+
+// code_cache.hpp, code_space.hpp
+OAKNUT_EXCEPTION(CodeCacheFull, "code cache has no space left for the allocation")
+
+// call_site_table.hpp
+OAKNUT_EXCEPTION(ResolverNotEmitted, "veneers cannot be emitted before the resolver")
+
+// code_reclaimer.hpp
+OAKNUT_EXCEPTION(TooManyThreads, "no free thread slot in the reclaimer")
+
+// linker.hpp
+OAKNUT_EXCEPTION(DuplicateSymbol, "a function with this symbol has already been added")
+OAKNUT_EXCEPTION(UndefinedSymbol, "reference to a symbol that has not been added")
@@ -5,7 +5,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <variant>
 
 #include "oaknut/oaknut_exception.hpp"
 
@@ -33,29 +32,58 @@ constexpr std::uint64_t sign_extend(std::uint64_t value)
     return static_cast<std::uint64_t>(static_cast<std::int64_t>(value << shift_amount) >> shift_amount);
 }
 
+// Operand of a PC-relative field: an already encoded displacement, a label, or an absolute address.
+// Stored as a tag and an untagged union, so that encoding dispatches on the tag alone.
+struct OffsetPayload {
+    enum class Kind : std::uint8_t {
+        Encoded,
+        Label,
+        Pointer,
+    };
+
+    constexpr explicit OffsetPayload(std::uint32_t encoded_)
+        : kind(Kind::Encoded), encoded(encoded_)
+    {}
+
+    constexpr explicit OffsetPayload(oaknut::Label* label_)
+        : kind(Kind::Label), label(label_)
+    {}
+
+    constexpr explicit OffsetPayload(const void* ptr_)
+        : kind(Kind::Pointer), ptr(ptr_)
+    {}
+
+    Kind kind;
+    union {
+        std::uint32_t encoded;
+        oaknut::Label* label;
+        const void* ptr;
+    };
+};
+
 }  // namespace detail
 
 template<std::size_t bitsize, std::size_t alignment>
 struct AddrOffset {
-    AddrOffset(std::ptrdiff_t diff)
+    constexpr AddrOffset(std::ptrdiff_t diff)
         : m_payload(encode(diff))
     {}
 
-    AddrOffset(Label& label)
+    constexpr AddrOffset(Label& label)
         : m_payload(&label)
     {}
 
-    AddrOffset(const void* ptr)
+    constexpr AddrOffset(const void* ptr)
         : m_payload(ptr)
     {}
 
-    static std::uint32_t encode(std::ptrdiff_t diff)
+    static constexpr std::uint32_t encode(std::ptrdiff_t diff)
     {
         const std::uint64_t diff_u64 = static_cast<std::uint64_t>(diff);
         if (detail::sign_extend<bitsize>(diff_u64) != diff_u64)
-            throw OaknutException{ExceptionType::OffsetOutOfRange};
+            detail::report_error(ExceptionType::OffsetOutOfRange);
         if (diff_u64 != (diff_u64 & detail::inverse_mask_from_size(alignment)))
-            throw OaknutException{ExceptionType::OffsetMisaligned};
+            detail::report_error(ExceptionType::OffsetMisaligned);
 
         return static_cast<std::uint32_t>((diff_u64 & detail::mask_from_size(bitsize)) >> alignment);
     }
@@ -63,29 +91,29 @@ struct AddrOffset {
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::variant<std::uint32_t, Label*, const void*> m_payload;
+    detail::OffsetPayload m_payload;
 };
 
 template<std::size_t bitsize, std::size_t shift_amount>
 struct PageOffset {
-    PageOffset(const void* ptr)
+    constexpr PageOffset(const void* ptr)
         : m_payload(ptr)
     {}
 
-    PageOffset(Label& label)
+    constexpr PageOffset(Label& label)
         : m_payload(&label)
     {}
 
-    static std::uint32_t encode(std::uintptr_t current_addr, std::uintptr_t target)
+    static constexpr std::uint32_t encode(std::uintptr_t current_addr, std::uintptr_t target)
     {
         std::uint64_t diff = static_cast<std::uint64_t>((static_cast<std::int64_t>(target) >> shift_amount) - (static_cast<std::int64_t>(current_addr) >> shift_amount));
         if (detail::sign_extend<bitsize>(diff) != diff)
-            throw OaknutException{ExceptionType::OffsetOutOfRange};
+            detail::report_error(ExceptionType::OffsetOutOfRange);
         diff &= detail::mask_from_size(bitsize);
         return static_cast<std::uint32_t>(((diff & 3) << (bitsize - 2)) | (diff >> 2));
     }
 
-    static bool valid(std::uintptr_t current_addr, std::uintptr_t target)
+    static constexpr bool valid(std::uintptr_t current_addr, std::uintptr_t target)
     {
         std::uint64_t diff = static_cast<std::uint64_t>((static_cast<std::int64_t>(target) >> shift_amount) - (static_cast<std::int64_t>(current_addr) >> shift_amount));
         return detail::sign_extend<bitsize>(diff) == diff;
@@ -94,18 +122,18 @@ struct PageOffset {
 private:
     template<typename Policy>
     friend class BasicCodeGenerator;
-    std::variant<Label*, const void*> m_payload;
+    detail::OffsetPayload m_payload;  // never Kind::Encoded
 };
 
 template<std::size_t bitsize, std::size_t alignment>
 struct SOffset {
-    SOffset(std::int64_t offset)
+    constexpr SOffset(std::int64_t offset)
     {
         const std::uint64_t diff_u64 = static_cast<std::uint64_t>(offset);
         if (detail::sign_extend<bitsize>(diff_u64) != diff_u64)
-            throw OaknutException{ExceptionType::OffsetOutOfRange};
+            detail::report_error(ExceptionType::OffsetOutOfRange);
         if (diff_u64 != (diff_u64 & detail::inverse_mask_from_size(alignment)))
-            throw OaknutException{ExceptionType::OffsetMisaligned};
+            detail::report_error(ExceptionType::OffsetMisaligned);
 
         m_encoded = static_cast<std::uint32_t>((diff_u64 & detail::mask_from_size(bitsize)) >> alignment);
     }
@@ -118,13 +146,13 @@ private:
 
 template<std::size_t bitsize, std::size_t alignment>
 struct POffset {
-    POffset(std::int64_t offset)
+    constexpr POffset(std::int64_t offset)
     {
         const std::uint64_t diff_u64 = static_cast<std::uint64_t>(offset);
         if (diff_u64 > detail::mask_from_size(bitsize))
-            throw OaknutException{ExceptionType::OffsetOutOfRange};
+            detail::report_error(ExceptionType::OffsetOutOfRange);
         if (diff_u64 != (diff_u64 & detail::inverse_mask_from_size(alignment)))
-            throw OaknutException{ExceptionType::OffsetMisaligned};
+            detail::report_error(ExceptionType::OffsetMisaligned);
 
         m_encoded = static_cast<std::uint32_t>((diff_u64 & detail::mask_from_size(bitsize)) >> alignment);
     }
@@ -1,16 +0,0 @@
-// SPDX-FileCopyrightText: Copyright (c) 2023 merryhime <https://mary.rs>
-// SPDX-License-Identifier: MIT
-
-#pragma once
-
-namespace oaknut::detail {
-
-template<class... Ts>
-struct overloaded : Ts... {
-    using Ts::operator()...;
-};
-
-template<class... Ts>
-overloaded(Ts...) -> overloaded<Ts...>;
-
-}  // namespace oaknut::detail
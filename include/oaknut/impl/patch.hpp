@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "oaknut/impl/cache_maintenance.hpp"
+#include "oaknut/oaknut_exception.hpp"
+
+namespace oaknut {
+
+// An instruction to be written over the one at ptr (an executable address) by CodeBlock::patch or DualCodeBlock::patch.
+struct PatchSite {
+    std::uint32_t* ptr;
+    std::uint32_t instruction;
+};
+
+inline constexpr std::uint32_t nop_instruction = 0xd503'201f;
+
+/// True for the instructions that may be replaced while other threads are executing them, and that may replace
+/// them, without further synchronization (B, BL, NOP, BRK, SVC, HVC, SMC and ISB).
+constexpr bool is_cmodx_safe(std::uint32_t instruction)
+{
+    return (instruction & 0x7c00'0000) == 0x1400'0000     // B, BL
+           || instruction == nop_instruction               // NOP
+           || (instruction & 0xffff'f0ff) == 0xd503'30df  // ISB
+           || (instruction & 0xffe0'001f) == 0xd420'0000  // BRK
+           || ((instruction & 0xffe0'001c) == 0xd400'0000 && (instruction & 3) != 0);  // SVC, HVC, SMC
+}
+
+/// B from the instruction at from (an executable address) to to.
+inline std::uint32_t encode_b(const std::uint32_t* from, const void* to)
+{
+    const std::ptrdiff_t diff = reinterpret_cast<std::intptr_t>(to) - reinterpret_cast<std::intptr_t>(from);
+    if (diff < -(std::ptrdiff_t{1} << 27) || diff >= (std::ptrdiff_t{1} << 27))
+        detail::report_error(ExceptionType::OffsetOutOfRange);
+    if ((diff & 3) != 0)
+        detail::report_error(ExceptionType::OffsetMisaligned);
+    return 0x1400'0000 | static_cast<std::uint32_t>((diff >> 2) & 0x03ff'ffff);
+}
+
+/// BL from the instruction at from (an executable address) to to.
+inline std::uint32_t encode_bl(const std::uint32_t* from, const void* to)
+{
+    return encode_b(from, to) | 0x8000'0000;
+}
+
+namespace detail {
+
+// Writes each site through its mirror in [wbase, ...) and then performs cache maintenance once for each cache line
+// written. Nothing is written unless every site is safe to modify concurrently with execution.
+inline void patch_instructions(std::uint32_t* wbase, std::uint32_t* xbase, std::span<const PatchSite> sites)
+{
+    for (const PatchSite& site : sites) {
+        const std::uint32_t* wptr = wbase + (site.ptr - xbase);
+        if (!is_cmodx_safe(*wptr) || !is_cmodx_safe(site.instruction))
+            return report_error(ExceptionType::UnsafePatch);
+    }
+
+    // A naturally aligned word store is single-copy atomic, so a concurrently executing thread fetches either
+    // the old or the new instruction.
+    for (const PatchSite& site : sites)
+        std::atomic_ref<std::uint32_t>{wbase[site.ptr - xbase]}.store(site.instruction, std::memory_order_relaxed);
+
+#if defined(__APPLE__) || defined(_WIN32)
+    for (const PatchSite& site : sites)
+        invalidate_icache(site.ptr, sizeof(std::uint32_t));
+#else
+    const CacheGeometry geometry = cache_geometry();
+
+    // Sites on the same line as the one before them are skipped, which covers the common case of sorted sites.
+    if (!geometry.idc) {
+        std::uintptr_t last = ~std::uintptr_t{0};
+        for (const PatchSite& site : sites) {
+            const std::uintptr_t line = reinterpret_cast<std::uintptr_t>(site.ptr) & ~(geometry.dcache_line - 1);
+            if (line != last)
+                clean_dcache_line(line);
+            last = line;
+        }
+    }
+    dsb_ish();
+
+    if (!geometry.dic) {
+        std::uintptr_t last = ~std::uintptr_t{0};
+        for (const PatchSite& site : sites) {
+            const std::uintptr_t line = reinterpret_cast<std::uintptr_t>(site.ptr) & ~(geometry.icache_line - 1);
+            if (line != last)
+                invalidate_icache_line(line);
+            last = line;
+        }
+        dsb_ish();
+    }
+    isb();
+#endif
+}
+
+// Atomically replaces the 64-bit value at xptr through its mirror in [wbase, ...). As the value is data (such as a
+// literal loaded by LDR), no cache maintenance is required. Writes made before the store (such as the code a new
+// branch target refers to) are visible to any thread that loads the new value.
+inline void patch_data(std::uint32_t* wbase, std::uint32_t* xbase, std::uint64_t* xptr, std::uint64_t value)
+{
+    std::uint64_t* wptr = reinterpret_cast<std::uint64_t*>(wbase + (reinterpret_cast<std::uint32_t*>(xptr) - xbase));
+    std::atomic_ref<std::uint64_t>{*wptr}.store(value, std::memory_order_release);
+}
+
+}  // namespace detail
+
+}  // namespace oaknut
@@ -119,14 +119,14 @@ struct WReg : public RReg {
 inline XReg RReg::toX() const
 {
     if (index() == -1)
-        throw OaknutException{ExceptionType::InvalidXSPConversion};
+        detail::report_error(ExceptionType::InvalidXSPConversion);
     return XReg{index()};
 }
 
 inline WReg RReg::toW() const
 {
     if (index() == -1)
-        throw OaknutException{ExceptionType::InvalidWSPConversion};
+        detail::report_error(ExceptionType::InvalidWSPConversion);
     return WReg{index()};
 }
 
@@ -148,7 +148,7 @@ struct XRegSp : public RReg {
         : RReg(64, xr.index())
     {
         if (xr.index() == 31)
-            throw OaknutException{ExceptionType::InvalidXZRConversion};
+            detail::report_error(ExceptionType::InvalidXZRConversion);
     }
 
     template<typename Policy>
@@ -163,7 +163,7 @@ struct WRegWsp : public RReg {
         : RReg(32, wr.index())
     {
         if (wr.index() == 31)
-            throw OaknutException{ExceptionType::InvalidWZRConversion};
+            detail::report_error(ExceptionType::InvalidWZRConversion);
     }
 
     template<typename Policy>
@@ -298,7 +298,7 @@ struct Elem {
         : m_esize(esize_), m_reg(reg_), m_elem_index(elem_index_)
     {
         if (elem_index_ >= 128 / esize_)
-            throw OaknutException{ExceptionType::InvalidElementIndex};
+            detail::report_error(ExceptionType::InvalidElementIndex);
     }
 
     constexpr unsigned esize() const { return m_esize; }
@@ -340,7 +340,7 @@ struct DElem_1 : public DElem {
         : DElem(inner)
     {
         if (inner.elem_index() != 1)
-            throw OaknutException{ExceptionType::InvalidDElem_1};
+            detail::report_error(ExceptionType::InvalidDElem_1);
     }
 };
 
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "oaknut/impl/offset.hpp"
+
+namespace oaknut {
+
+enum class RelocationKind : std::uint8_t {
+    Branch26,  // B, BL
+    Branch19,  // B.cond, CBZ, CBNZ, LDR (literal), LDRSW (literal), PRFM (literal)
+    Branch14,  // TBZ, TBNZ
+    Adr,       // ADR
+    Adrp,      // ADRP
+    Abs64,     // doubleword emitted by dx(Label&)
+    MovAbs64,  // MOVZ and three MOVKs emitted by MOVP2R
+};
+
+// A field of emitted code that depends on the address the code is placed at.
+struct Relocation {
+    std::ptrdiff_t offset;  // of the instruction or doubleword, from the start of the code
+    RelocationKind kind;
+    bool internal;          // whether target is an offset from the start of the code, rather than an absolute address
+    std::uint64_t target;
+
+    bool operator==(const Relocation&) const = default;
+};
+
+// Fills in the relocated fields of code, which was emitted with relocation recording enabled, so that it runs at
+// xaddr. code may be relocated any number of times. xaddr must be aligned at least as strictly as any alignment
+// requested while emitting, and to 16 bytes if literals were emitted. Reports OffsetOutOfRange if a target is out
+// of range of its instruction.
+inline void relocate(std::span<std::uint32_t> code, std::span<const Relocation> relocations, std::uintptr_t xaddr)
+{
+    constexpr std::uint32_t imm26_mask = 0x03FF'FFFF;
+    constexpr std::uint32_t imm19_mask = 0x00FF'FFE0;
+    constexpr std::uint32_t imm14_mask = 0x0007'FFE0;
+    constexpr std::uint32_t adr_mask = 0x60FF'FFE0;
+
+    const auto set_adr = [](std::uint32_t& word, std::uint32_t value) {
+        // value is immhi:immlo rotated so that immlo is in its top two bits; see PageOffset::encode.
+        word = (word & ~adr_mask) | ((value & 0x7FFFF) << 5) | ((value >> 19) << 29);
+    };
+
+    for (const Relocation& relocation : relocations) {
+        const std::size_t index = static_cast<std::size_t>(relocation.offset) / sizeof(std::uint32_t);
+        const std::uintptr_t pc = xaddr + static_cast<std::uintptr_t>(relocation.offset);
+        const std::uintptr_t target = relocation.internal ? xaddr + relocation.target : relocation.target;
+        const auto diff = static_cast<std::ptrdiff_t>(target - pc);
+        std::uint32_t& word = code[index];
+
+        switch (relocation.kind) {
+        case RelocationKind::Branch26:
+            word = (word & ~imm26_mask) | AddrOffset<28, 2>::encode(diff);
+            break;
+        case RelocationKind::Branch19:
+            word = (word & ~imm19_mask) | (AddrOffset<21, 2>::encode(diff) << 5);
+            break;
+        case RelocationKind::Branch14:
+            word = (word & ~imm14_mask) | (AddrOffset<16, 2>::encode(diff) << 5);
+            break;
+        case RelocationKind::Adr:
+            set_adr(word, PageOffset<21, 0>::encode(pc, target));
+            break;
+        case RelocationKind::Adrp:
+            set_adr(word, PageOffset<21, 12>::encode(pc, target));
+            break;
+        case RelocationKind::Abs64:
+            code[index] = static_cast<std::uint32_t>(target);
+            code[index + 1] = static_cast<std::uint32_t>(target >> 32);
+            break;
+        case RelocationKind::MovAbs64:
+            for (std::size_t i = 0; i < 4; i++)
+                code[index + i] = (code[index + i] & ~std::uint32_t{0x001F'FFE0}) | (static_cast<std::uint32_t>(target >> (16 * i)) & 0xFFFF) << 5;
+            break;
+        }
+    }
+}
+
+}  // namespace oaknut
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace oaknut {
+
+// Instruction storage made of fixed-size segments, for use with SegmentedCodeGenerator.
+// Growing allocates a new segment instead of reallocating, so emitted words are never copied until copy_to().
+// Segments are kept across clear() and reused. Allocator may be any allocator of std::uint32_t,
+// including std::pmr::polymorphic_allocator<std::uint32_t>.
+template<typename Allocator = std::allocator<std::uint32_t>>
+class SegmentedBuffer {
+public:
+    using allocator_type = Allocator;
+
+    static constexpr std::size_t default_segment_words = 16384;
+
+    /// segment_words is rounded up to a power of two.
+    explicit SegmentedBuffer(std::size_t segment_words = default_segment_words, const Allocator& allocator = Allocator())
+        : m_allocator(allocator)
+        , m_segments(SegmentTableAllocator(m_allocator))
+        , m_shift(std::bit_width(std::max<std::size_t>(segment_words, 2) - 1))
+    {}
+
+    explicit SegmentedBuffer(const Allocator& allocator)
+        : SegmentedBuffer(default_segment_words, allocator)
+    {}
+
+    ~SegmentedBuffer()
+    {
+        for (std::uint32_t* segment : m_segments)
+            std::allocator_traits<Allocator>::deallocate(m_allocator, segment, segment_words());
+    }
+
+    SegmentedBuffer(const SegmentedBuffer&) = delete;
+    SegmentedBuffer& operator=(const SegmentedBuffer&) = delete;
+
+    void append(std::uint32_t word)
+    {
+        if (m_cur == m_end) [[unlikely]]
+            next_segment();
+        *m_cur++ = word;
+    }
+
+    void append(const std::uint32_t* words, std::size_t count)
+    {
+        while (count != 0) {
+            if (m_cur == m_end)
+                next_segment();
+            const std::size_t chunk = std::min(count, static_cast<std::size_t>(m_end - m_cur));
+            m_cur = std::copy_n(words, chunk, m_cur);
+            words += chunk;
+            count -= chunk;
+        }
+    }
+
+    /// Number of words appended since construction or the last clear().
+    std::size_t size() const
+    {
+        return m_base + static_cast<std::size_t>(m_cur - m_begin);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    std::size_t segment_words() const
+    {
+        return std::size_t{1} << m_shift;
+    }
+
+    /// Allocates segments up front so that the first `words` words can be appended without allocation.
+    void reserve(std::size_t words)
+    {
+        const std::size_t count = (words + segment_words() - 1) >> m_shift;
+        m_segments.reserve(count);
+        while (m_segments.size() < count)
+            m_segments.push_back(std::allocator_traits<Allocator>::allocate(m_allocator, segment_words()));
+    }
+
+    void clear()
+    {
+        m_begin = m_cur = m_end = nullptr;
+        m_base = 0;
+        m_used = 0;
+    }
+
+    std::uint32_t& operator[](std::size_t index)
+    {
+        return m_segments[index >> m_shift][index & (segment_words() - 1)];
+    }
+
+    std::uint32_t operator[](std::size_t index) const
+    {
+        return m_segments[index >> m_shift][index & (segment_words() - 1)];
+    }
+
+    /// Copies the contents to dest, which must have room for size() words.
+    void copy_to(std::uint32_t* dest) const
+    {
+        std::size_t remaining = size();
+        for (std::size_t i = 0; remaining != 0; i++) {
+            const std::size_t count = std::min(remaining, segment_words());
+            std::copy_n(m_segments[i], count, dest);
+            dest += count;
+            remaining -= count;
+        }
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_allocator;
+    }
+
+private:
+    using SegmentTableAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint32_t*>;
+
+    void next_segment()
+    {
+        if (m_used != 0)
+            m_base += segment_words();
+        if (m_used == m_segments.size())
+            m_segments.push_back(std::allocator_traits<Allocator>::allocate(m_allocator, segment_words()));
+        m_begin = m_cur = m_segments[m_used++];
+        m_end = m_begin + segment_words();
+    }
+
+    Allocator m_allocator;
+    std::vector<std::uint32_t*, SegmentTableAllocator> m_segments;
+    int m_shift;
+
+    std::uint32_t* m_begin = nullptr;
+    std::uint32_t* m_cur = nullptr;
+    std::uint32_t* m_end = nullptr;
+    std::size_t m_base = 0;  // words in the segments before the current one
+    std::size_t m_used = 0;  // segments in use, including the current one
+};
+
+}  // namespace oaknut
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace oaknut::detail {
+
+// Append-only sequence whose elements never move, so references to them stay valid as it grows.
+// Elements are stored in fixed-capacity chunks. Unlike std::deque, this is usable in constant evaluation.
+template<typename T, std::size_t chunk_size = 64>
+class StableVector {
+public:
+    static_assert((chunk_size & (chunk_size - 1)) == 0, "chunk_size must be a power of two");
+
+    constexpr std::size_t size() const
+    {
+        return m_size;
+    }
+
+    constexpr T& emplace_back()
+    {
+        if (m_size % chunk_size == 0) {
+            m_chunks.emplace_back();
+            m_chunks.back().reserve(chunk_size);
+        }
+        m_size++;
+        return m_chunks.back().emplace_back();
+    }
+
+    constexpr T& operator[](std::size_t index)
+    {
+        return m_chunks[index / chunk_size][index % chunk_size];
+    }
+
+    constexpr const T& operator[](std::size_t index) const
+    {
+        return m_chunks[index / chunk_size][index % chunk_size];
+    }
+
+private:
+    std::vector<std::vector<T>> m_chunks;  // each chunk's capacity is reserved up front and never exceeded
+    std::size_t m_size = 0;
+};
+
+}  // namespace oaknut::detail
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "oaknut/impl/fixup_table.hpp"
+#include "oaknut/impl/reg.hpp"
+
+namespace oaknut {
+
+struct Label;
+
+// A field of an instruction word that is filled in when a stencil is instantiated: either width bits at shift,
+// which receive a value or register index verbatim, or the PC-relative offset to a label.
+struct StencilField {
+    constexpr StencilField(std::uint8_t shift_, std::uint8_t width_)
+        : shift(shift_), width(width_)
+    {}
+
+    constexpr explicit StencilField(detail::FixupKind kind)
+        : is_label(true), label_kind(kind)
+    {}
+
+    constexpr std::uint32_t mask() const
+    {
+        return ((std::uint32_t{1} << width) - 1) << shift;
+    }
+
+    std::uint8_t shift = 0;
+    std::uint8_t width = 0;
+    bool is_label = false;
+    detail::FixupKind label_kind = detail::FixupKind::Imm26;
+};
+
+struct StencilHole {
+    std::size_t word;
+    StencilField field;
+};
+
+// Pre-encoded instruction words with holes, emitted with BasicCodeGenerator::emit_stencil.
+// Fields that are not holes (including operand sizes and arrangements) are fixed by the words, and the bits of value
+// holes are zero. Stencils are used as template arguments, so that the hole plan is known at compile time.
+template<std::size_t N, std::size_t H>
+struct Stencil {
+    static_assert(N != 0, "A stencil must contain at least one word");
+
+    std::array<std::uint32_t, N> words;
+    std::array<StencilHole, H> holes;
+};
+
+// The value of a hole: a register (its index is used), a raw field value, or a label.
+struct StencilArg {
+    constexpr /* implicit */ StencilArg(Reg reg)
+        : value(static_cast<std::uint32_t>(reg.index() & 31))
+    {}
+
+    constexpr /* implicit */ StencilArg(std::uint32_t value_)
+        : value(value_)
+    {}
+
+    constexpr /* implicit */ StencilArg(Label& label_)
+        : label(&label_)
+    {}
+
+    std::uint32_t value = 0;
+    Label* label = nullptr;
+};
+
+// Common fields
+namespace stencil {
+
+inline constexpr StencilField Rd{0, 5}, Rt{0, 5};
+inline constexpr StencilField Rn{5, 5};
+inline constexpr StencilField Rt2{10, 5}, Ra{10, 5};
+inline constexpr StencilField Rm{16, 5}, Rs{16, 5};
+inline constexpr StencilField Imm6{10, 6};    // shift amount of shifted register forms
+inline constexpr StencilField Imm9{12, 9};    // unscaled, pre- and post-indexed offsets (two's complement)
+inline constexpr StencilField Imm12{10, 12};  // ADD/SUB (immediate), scaled unsigned offsets
+inline constexpr StencilField Imm16{5, 16};   // MOVZ, MOVN, MOVK
+inline constexpr StencilField Branch26{detail::FixupKind::Imm26};  // B, BL
+inline constexpr StencilField Branch19{detail::FixupKind::Imm19};  // B.cond, CBZ, CBNZ, LDR (literal)
+inline constexpr StencilField Branch14{detail::FixupKind::Imm14};  // TBZ, TBNZ
+inline constexpr StencilField Adr{detail::FixupKind::Adr};
+inline constexpr StencilField Adrp{detail::FixupKind::Adrp};
+
+}  // namespace stencil
+
+}  // namespace oaknut
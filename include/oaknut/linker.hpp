@@ -0,0 +1,313 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "oaknut/impl/code_block_options.hpp"
+#include "oaknut/oaknut.hpp"
+
+namespace oaknut {
+
+// A B or BL at offset bytes into a function, to the function symbol.
+struct SymbolReference {
+    std::ptrdiff_t offset;
+    std::uint64_t symbol;
+};
+
+// A separately emitted function, for Linker.
+struct LinkerFunction {
+    std::uint64_t symbol = 0;
+    double weight = 0;                             // hotness; functions of weight 0 are cold
+    std::vector<std::uint32_t> code = {};
+    std::vector<Relocation> relocations = {};      // recorded with set_relocation_recording(true)
+    std::vector<SymbolReference> references = {};  // from Linker::emit_call and Linker::emit_jump
+};
+
+struct LinkerOptions {
+    // Alignment of each function, at least 16.
+    std::size_t function_alignment = 16;
+    // Reach of a direct B or BL. Calls farther than this go through a range-extension thunk.
+    std::size_t branch_range = near_branch_range;
+};
+
+// Lays out many separately emitted functions in one code region, and links calls between them.
+//
+// Hot functions (in order of decreasing weight) are placed first, each directly followed by those of its hot callees
+// not yet placed, so that callers and their callees share cache lines and pages; cold functions follow in the order
+// they were added. Calls between functions become direct B or BL. Calls that are out of range go through a thunk
+// (ADRP, ADD, BR X16) in the island of thunks nearest to the caller; callers near each other share a thunk to the
+// same function. Islands are placed between functions every branch_range / 2 bytes.
+class Linker {
+public:
+    explicit Linker(const LinkerOptions& options = {})
+        : m_options(options)
+    {}
+
+    // Emits a BL to the function symbol, and records it in references.
+    template<typename Policy>
+    static void emit_call(BasicCodeGenerator<Policy>& code, std::vector<SymbolReference>& references, std::uint64_t symbol)
+    {
+        code.BL(AddrOffset<28, 2>{std::ptrdiff_t{0}});
+        references.push_back(SymbolReference{code.offset() - 4, symbol});
+    }
+
+    // Emits a B to the function symbol (a tail call), and records it in references.
+    template<typename Policy>
+    static void emit_jump(BasicCodeGenerator<Policy>& code, std::vector<SymbolReference>& references, std::uint64_t symbol)
+    {
+        code.B(AddrOffset<28, 2>{std::ptrdiff_t{0}});
+        references.push_back(SymbolReference{code.offset() - 4, symbol});
+    }
+
+    // Reports DuplicateSymbol if a function with the same symbol has already been added.
+    void add(LinkerFunction function)
+    {
+        if (!m_symbols.emplace(function.symbol, m_functions.size()).second)
+            return detail::report_error(ExceptionType::DuplicateSymbol);
+        m_functions.push_back(std::move(function));
+        m_laid_out = false;
+    }
+
+    // Lays out the functions and thunks, and returns the size in bytes of the linked code.
+    // Reports UndefinedSymbol if a function references a symbol that has not been added.
+    std::size_t layout()
+    {
+        if (m_laid_out)
+            return m_size;
+
+        order_functions();
+        place_islands();
+
+        bool changed = true;
+        while (changed) {
+            assign_offsets();
+            changed = add_thunks();
+        }
+
+        m_laid_out = true;
+        return m_size;
+    }
+
+    // Writes the linked code to wptr, to be executed at xptr, which must be aligned to function_alignment. Both must
+    // have room for layout() bytes. The caller must invalidate the instruction cache for the code afterwards.
+    void link(std::uint32_t* wptr, std::uint32_t* xptr)
+    {
+        layout();
+
+        const auto xaddr = reinterpret_cast<std::uintptr_t>(xptr);
+        for (std::size_t i = 0; i < m_functions.size(); i++) {
+            const LinkerFunction& function = m_functions[i];
+            std::uint32_t* const fwptr = wptr + m_offsets[i] / sizeof(std::uint32_t);
+
+            std::copy(function.code.begin(), function.code.end(), fwptr);
+            relocate(std::span{fwptr, function.code.size()}, function.relocations, xaddr + m_offsets[i]);
+
+            for (const SymbolReference& reference : function.references) {
+                const std::size_t callee = index_of(reference.symbol);
+                if (callee == npos)
+                    continue;
+
+                const std::ptrdiff_t site = m_offsets[i] + reference.offset;
+                const std::ptrdiff_t target = resolve(site, callee);
+                std::uint32_t& word = fwptr[reference.offset / sizeof(std::uint32_t)];
+                word = (word & 0xFC00'0000) | AddrOffset<28, 2>::encode(target - site);
+            }
+        }
+
+        for (const Island& island : m_islands) {
+            for (std::size_t t = 0; t < island.targets.size(); t++) {
+                const std::ptrdiff_t thunk = island.offset + static_cast<std::ptrdiff_t>(t * thunk_size);
+                CodeGenerator code{wptr + thunk / sizeof(std::uint32_t), xptr + thunk / sizeof(std::uint32_t)};
+                code.ADRL(util::X16, xptr + m_offsets[island.targets[t]] / sizeof(std::uint32_t));
+                code.BR(util::X16);
+            }
+        }
+    }
+
+    // Offset in bytes of the function symbol from the start of the linked code.
+    std::ptrdiff_t offset(std::uint64_t symbol)
+    {
+        layout();
+        const std::size_t index = index_of(symbol);
+        return index == npos ? 0 : m_offsets[index];
+    }
+
+    std::size_t thunk_count() const
+    {
+        std::size_t count = 0;
+        for (const Island& island : m_islands)
+            count += island.targets.size();
+        return count;
+    }
+
+private:
+    static constexpr std::size_t thunk_size = 3 * sizeof(std::uint32_t);
+
+    struct Island {
+        std::size_t position;               // number of functions in m_order before the island
+        std::ptrdiff_t offset = 0;
+        std::vector<std::size_t> targets;   // function index of each thunk
+        std::unordered_set<std::size_t> target_set;
+    };
+
+    std::size_t index_of(std::uint64_t symbol) const
+    {
+        const auto iter = m_symbols.find(symbol);
+        if (iter == m_symbols.end()) {
+            detail::report_error(ExceptionType::UndefinedSymbol);
+            return npos;
+        }
+        return iter->second;
+    }
+
+    void order_functions()
+    {
+        std::vector<std::size_t> by_weight(m_functions.size());
+        for (std::size_t i = 0; i < by_weight.size(); i++)
+            by_weight[i] = i;
+        std::stable_sort(by_weight.begin(), by_weight.end(), [&](std::size_t a, std::size_t b) { return m_functions[a].weight > m_functions[b].weight; });
+
+        m_order.clear();
+        std::vector<bool> placed(m_functions.size());
+        std::vector<std::size_t> stack;
+        for (const std::size_t root : by_weight) {
+            if (m_functions[root].weight <= 0)
+                break;
+            stack.push_back(root);
+            while (!stack.empty()) {
+                const std::size_t i = stack.back();
+                stack.pop_back();
+                if (placed[i])
+                    continue;
+                placed[i] = true;
+                m_order.push_back(i);
+
+                const auto& references = m_functions[i].references;
+                for (auto iter = references.rbegin(); iter != references.rend(); ++iter) {
+                    const std::size_t callee = index_of(iter->symbol);
+                    if (callee != npos && !placed[callee] && m_functions[callee].weight > 0)
+                        stack.push_back(callee);
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < m_functions.size(); i++) {
+            if (!placed[i])
+                m_order.push_back(i);
+        }
+    }
+
+    void place_islands()
+    {
+        m_islands.clear();
+
+        const std::size_t interval = m_options.branch_range / 2;
+        std::size_t since_island = 0;
+        for (std::size_t position = 0; position < m_order.size(); position++) {
+            since_island += m_functions[m_order[position]].code.size() * sizeof(std::uint32_t);
+            if (since_island >= interval) {
+                m_islands.push_back(Island{position + 1, 0, {}, {}});
+                since_island = 0;
+            }
+        }
+    }
+
+    void assign_offsets()
+    {
+        m_offsets.resize(m_functions.size());
+
+        std::size_t offset = 0;
+        auto island = m_islands.begin();
+        for (std::size_t position = 0; position < m_order.size(); position++) {
+            for (; island != m_islands.end() && island->position == position; ++island) {
+                island->offset = static_cast<std::ptrdiff_t>(offset);
+                offset += island->targets.size() * thunk_size;
+            }
+
+            offset = (offset + m_options.function_alignment - 1) / m_options.function_alignment * m_options.function_alignment;
+            m_offsets[m_order[position]] = static_cast<std::ptrdiff_t>(offset);
+            offset += m_functions[m_order[position]].code.size() * sizeof(std::uint32_t);
+        }
+        for (; island != m_islands.end(); ++island) {
+            island->offset = static_cast<std::ptrdiff_t>(offset);
+            offset += island->targets.size() * thunk_size;
+        }
+
+        m_size = offset;
+    }
+
+    bool in_range(std::ptrdiff_t site, std::ptrdiff_t target) const
+    {
+        const auto range = static_cast<std::ptrdiff_t>(m_options.branch_range);
+        return target - site >= -range && target - site <= range;
+    }
+
+    Island* nearest_island(std::ptrdiff_t site)
+    {
+        Island* nearest = nullptr;
+        for (Island& island : m_islands) {
+            if (!nearest || std::abs(island.offset - site) < std::abs(nearest->offset - site))
+                nearest = &island;
+        }
+        return nearest;
+    }
+
+    // Adds the thunks needed for the current offsets. Returns whether any were added.
+    bool add_thunks()
+    {
+        bool changed = false;
+        for (std::size_t i = 0; i < m_functions.size(); i++) {
+            for (const SymbolReference& reference : m_functions[i].references) {
+                const std::size_t target = index_of(reference.symbol);
+                if (target == npos)
+                    continue;
+
+                const std::ptrdiff_t site = m_offsets[i] + reference.offset;
+                if (in_range(site, m_offsets[target]))
+                    continue;
+
+                Island* island = nearest_island(site);
+                if (island && island->target_set.insert(target).second) {
+                    island->targets.push_back(target);
+                    changed = true;
+                }
+            }
+        }
+        return changed;
+    }
+
+    // Offset that the reference at site branches to in order to reach function target.
+    std::ptrdiff_t resolve(std::ptrdiff_t site, std::size_t target)
+    {
+        const Island* island = nearest_island(site);
+        if (in_range(site, m_offsets[target]) || !island)
+            return m_offsets[target];
+
+        const auto iter = std::find(island->targets.begin(), island->targets.end(), target);
+        return island->offset + static_cast<std::ptrdiff_t>((iter - island->targets.begin()) * thunk_size);
+    }
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    LinkerOptions m_options;
+    std::vector<LinkerFunction> m_functions;
+    std::unordered_map<std::uint64_t, std::size_t> m_symbols;
+
+    bool m_laid_out = false;
+    std::vector<std::size_t> m_order;      // function indices in layout order
+    std::vector<std::ptrdiff_t> m_offsets;  // indexed by function index
+    std::vector<Island> m_islands;         // in layout order
+    std::size_t m_size = 0;
+};
+
+}  // namespace oaknut
@@ -3,37 +3,86 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <span>
 #include <tuple>
 #include <type_traits>
-#include <variant>
+#include <utility>
 #include <vector>
 
+#include "oaknut/impl/dirty_ranges.hpp"
 #include "oaknut/impl/enum.hpp"
+#include "oaknut/impl/fixup_table.hpp"
 #include "oaknut/impl/imm.hpp"
 #include "oaknut/impl/list.hpp"
+#include "oaknut/impl/literal_pool.hpp"
+#include "oaknut/impl/mov_imm.hpp"
 #include "oaknut/impl/multi_typed_name.hpp"
 #include "oaknut/impl/offset.hpp"
-#include "oaknut/impl/overloaded.hpp"
 #include "oaknut/impl/reg.hpp"
+#include "oaknut/impl/relocation.hpp"
+#include "oaknut/impl/segmented_buffer.hpp"
+#include "oaknut/impl/stable_vector.hpp"
+#include "oaknut/impl/stencil.hpp"
 #include "oaknut/impl/string_literal.hpp"
 #include "oaknut/oaknut_exception.hpp"
 
 namespace oaknut {
 
+// A Label belongs to the code generator that first references or binds it.
+// Labels with pending references can be moved but not copied, and must not be overwritten; doing so reports
+// LabelHasPendingReferences. A referenced label must be bound before it is destroyed, or its fixup table entry in the
+// generator is not recycled.
 struct Label {
 public:
     Label() = default;
 
-    bool is_bound() const
+    constexpr Label(Label&& other) noexcept
+        : m_offset(other.m_offset), m_handle(std::exchange(other.m_handle, detail::FixupTable::npos))
+    {}
+
+    constexpr Label& operator=(Label&& other)
+    {
+        if (m_handle != detail::FixupTable::npos) [[unlikely]] {
+            if (this != &other)
+                detail::report_error(ExceptionType::LabelHasPendingReferences);
+            return *this;
+        }
+        m_offset = other.m_offset;
+        m_handle = std::exchange(other.m_handle, detail::FixupTable::npos);
+        return *this;
+    }
+
+    constexpr Label(const Label& other)
+        : m_offset(other.m_offset)
+    {
+        if (other.m_handle != detail::FixupTable::npos) [[unlikely]]
+            detail::report_error(ExceptionType::LabelHasPendingReferences);
+    }
+
+    constexpr Label& operator=(const Label& other)
+    {
+        if (m_handle != detail::FixupTable::npos || other.m_handle != detail::FixupTable::npos) [[unlikely]]
+            detail::report_error(ExceptionType::LabelHasPendingReferences);
+        else
+            m_offset = other.m_offset;
+        return *this;
+    }
+
+    constexpr bool is_bound() const
     {
         return m_offset.has_value();
     }
 
-    std::ptrdiff_t offset() const
+    constexpr std::ptrdiff_t offset() const
     {
         return m_offset.value();
     }
@@ -42,46 +91,110 @@ private:
     template<typename Policy>
     friend class BasicCodeGenerator;
 
-    explicit Label(std::ptrdiff_t offset)
+    constexpr explicit Label(std::ptrdiff_t offset)
         : m_offset(offset)
     {}
 
-    using EmitFunctionType = std::uint32_t (*)(std::ptrdiff_t wb_offset, std::ptrdiff_t resolved_offset);
-
-    struct Writeback {
-        std::ptrdiff_t m_wb_offset;
-        std::uint32_t m_mask;
-        EmitFunctionType m_fn;
-    };
-
     std::optional<std::ptrdiff_t> m_offset;
-    std::vector<Writeback> m_wbs;
+    std::uint32_t m_handle = detail::FixupTable::npos;
 };
 
 template<typename Policy>
 class BasicCodeGenerator : public Policy {
 public:
-    BasicCodeGenerator(typename Policy::constructor_argument_type arg, std::uint32_t* xmem)
+    constexpr BasicCodeGenerator(typename Policy::constructor_argument_type arg, std::uint32_t* xmem)
         : Policy(arg, xmem)
     {}
 
-    Label l() const
+    constexpr Label l() const
     {
         return Label{Policy::offset()};
     }
 
-    void l(Label& label) const
+    constexpr void l(Label& label)
     {
         if (label.is_bound())
-            throw OaknutException{ExceptionType::LabelRedefinition};
+            return detail::report_error(ExceptionType::LabelRedefinition);
 
         const auto target_offset = Policy::offset();
         label.m_offset = target_offset;
-        for (auto& wb : label.m_wbs) {
-            const std::uint32_t value = wb.m_fn(wb.m_wb_offset, target_offset);
-            Policy::set_at_offset(wb.m_wb_offset, value, wb.m_mask);
+        if (label.m_handle != detail::FixupTable::npos) {
+            m_fixups.for_each(label.m_handle, [&](const detail::Fixup& fixup) {
+                apply_fixup(fixup, target_offset);
+            });
+            m_fixups.release(label.m_handle);
+            label.m_handle = detail::FixupTable::npos;
         }
-        label.m_wbs.clear();
+    }
+
+    // With branch relaxation enabled, B.cond, CBZ, CBNZ, TBZ and TBNZ are no longer limited to their encodable range:
+    // * A backward branch to a label that is out of range is emitted as an inverted-condition skip over a B.
+    // * Before a pending forward branch would go out of range, a veneer island (a B over a run of Bs) is emitted
+    //   between instructions and the branch is redirected through it.
+    // Code size is therefore no longer a pure function of the instructions emitted. Every label referenced while
+    // relaxation is enabled must eventually be bound, as its pending references may be rewritten.
+    constexpr void set_branch_relaxation(bool enabled)
+    {
+        m_branch_relaxation = enabled;
+        update_island_deadline();
+    }
+
+    // With relocation recording enabled, fields that depend on where the code is placed are recorded as relocations
+    // instead of being encoded for xmem, so that the code can be placed anywhere with relocate():
+    // * Branches, ADR and ADRP to pointers are left zero, and must be filled in by relocate() even to run at xmem.
+    // * ADRP to labels, and dx(Label&), are recorded as relocations relative to the start of the code.
+    // * MOVP2R always emits MOVZ and three MOVKs, recorded as a relocation of the absolute address.
+    // References between labels are otherwise position-independent. Addresses of the code itself must only be taken
+    // through labels, not computed from xptr().
+    constexpr void set_relocation_recording(bool enabled)
+    {
+        m_relocation_recording = enabled;
+    }
+
+    // Relocations recorded so far, in no particular order.
+    constexpr std::span<const Relocation> relocations() const
+    {
+        return m_relocations;
+    }
+
+    constexpr void clear_relocations()
+    {
+        m_relocations.clear();
+    }
+
+    // Literal pool: returns a label for a constant, for use with LDR (literal). Identical constants share one entry.
+    // Pending constants are emitted by flush_literals(), or automatically (behind a branch over them) before the
+    // first load referencing them would go out of range. A returned label is only valid until the next flush.
+    constexpr Label& literal64(std::uint64_t value)
+    {
+        return add_literal(detail::Literal{value, 0, false});
+    }
+
+    constexpr Label& literal128(std::uint64_t lo, std::uint64_t hi)
+    {
+        return add_literal(detail::Literal{lo, hi, true});
+    }
+
+    // Emits pending literals at the current position. Execution must not fall through into them.
+    // Pending literals are only emitted automatically once code is emitted past their deadline, so this must be called
+    // at the end of every function that uses the literal pool (including through MOV and FMOV of vector registers).
+    constexpr void flush_literals()
+    {
+        emit_literal_pool();
+        m_island_deadline = island_deadline();
+    }
+
+    constexpr bool has_pending_literals() const
+    {
+        return !m_literals.empty();
+    }
+
+    // Checks that the code emitted so far is complete: reports UnflushedLiterals if literals are pending, as the
+    // loads referencing them would otherwise read their own encoding.
+    constexpr void finalize() const
+    {
+        if (has_pending_literals()) [[unlikely]]
+            detail::report_error(ExceptionType::UnflushedLiterals);
     }
 
 #include "oaknut/impl/mnemonics_fpsimd_v8.0.inc.hpp"
@@ -93,7 +206,7 @@ public:
 #include "oaknut/impl/mnemonics_generic_v8.2.inc.hpp"
 #include "oaknut/impl/mnemonics_generic_v8.3.inc.hpp"
 
-    void RET()
+    constexpr void RET()
     {
         return RET(XReg{30});
     }
@@ -104,7 +217,7 @@ public:
         ADD(xd, xd, reinterpret_cast<uint64_t>(addr) & 0xFFF);
     }
 
-    void MOV(WReg wd, uint32_t imm)
+    constexpr void MOV(WReg wd, uint32_t imm)
     {
         if (wd.index() == 31)
             return;
@@ -119,7 +232,7 @@ public:
         MOVK(wd, {static_cast<std::uint16_t>(imm >> 16), MovImm16Shift::SHL_16});
     }
 
-    void MOV(XReg xd, uint64_t imm)
+    constexpr void MOV(XReg xd, uint64_t imm)
     {
         if (xd.index() == 31)
             return;
@@ -132,34 +245,143 @@ public:
         if (detail::encode_bit_imm(imm))
             return ORR(xd, ZrReg{}, imm);
 
-        bool movz_done = false;
-        int shift_count = 0;
+        const detail::MovPlan plan = detail::plan_mov_imm64(imm);
+        switch (plan.base) {
+        case detail::MovPlan::Base::Movz:
+            MOVZ(xd, plan.value);
+            break;
+        case detail::MovPlan::Base::Movn:
+            MOVN(xd, ~plan.value);
+            break;
+        case detail::MovPlan::Base::Movn32:
+            MOVN(xd.toW(), static_cast<std::uint32_t>(~plan.value));
+            break;
+        case detail::MovPlan::Base::Orr:
+            ORR(xd, ZrReg{}, plan.value);
+            break;
+        case detail::MovPlan::Base::Orr32:
+            ORR(xd.toW(), WzrReg{}, static_cast<std::uint32_t>(plan.value));
+            break;
+        case detail::MovPlan::Base::Dup32:
+            MOV(xd.toW(), static_cast<std::uint32_t>(imm));
+            return ORR(xd, xd, xd, LogShift::LSL, 32);
+        }
 
-        if (detail::encode_bit_imm(static_cast<std::uint32_t>(imm))) {
-            ORR(xd.toW(), WzrReg{}, static_cast<std::uint32_t>(imm));
-            imm >>= 32;
-            movz_done = true;
-            shift_count = 2;
+        for (int i = 0; i < 4; i++) {
+            const std::uint16_t hw = detail::halfword(imm, i);
+            if (hw != detail::halfword(plan.value, i))
+                MOVK(xd, {hw, static_cast<MovImm16Shift>(i)});
         }
+    }
 
-        while (imm != 0) {
-            const uint16_t hw = static_cast<uint16_t>(imm);
-            if (hw != 0) {
-                if (movz_done) {
-                    MOVK(xd, {hw, static_cast<MovImm16Shift>(shift_count)});
-                } else {
-                    MOVZ(xd, {hw, static_cast<MovImm16Shift>(shift_count)});
-                    movz_done = true;
-                }
-            }
-            imm >>= 16;
-            shift_count++;
+    // Materializes a bit pattern in dd (zeroing the upper half of the vector register) without a general-purpose register:
+    // MOVI, MVNI or FMOV (immediate), possibly followed by ORR or BIC (immediate), else a load from the literal pool.
+    // A load from the pool is only valid once the pool has been emitted, so flush_literals() must follow; the overloads
+    // taking a scratch register never use the pool.
+    constexpr void MOV(DReg dd, std::uint64_t imm)
+    {
+        const detail::VectorMovPlan plan = detail::plan_vector_mov(imm);
+        if (plan.kind == detail::VectorMovPlan::Kind::Literal)
+            return LDR(dd, literal64(imm));
+        emit_vector_mov(dd, dd.B8(), dd.H4(), dd.S2(), plan);
+    }
+
+    constexpr void MOV(QReg qd, std::uint64_t lo, std::uint64_t hi)
+    {
+        if (hi == 0)
+            return MOV(qd.toD(), lo);
+        if (lo == hi) {
+            const detail::VectorMovPlan plan = detail::plan_vector_mov(lo);
+            if (plan.kind != detail::VectorMovPlan::Kind::Literal)
+                return emit_vector_mov(qd.D2(), qd.B16(), qd.H8(), qd.S4(), plan);
+        }
+        LDR(qd, literal128(lo, hi));
+    }
+
+    // As MOV (vector), but a single FMOV (scalar, immediate) is preferred. The bits of the vector register above
+    // those of sd are unspecified.
+    constexpr void FMOV(SReg sd, float value)
+    {
+        const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        if (const auto imm8 = detail::encode_fp_imm8(bits))
+            return FMOV(sd, FImm8{*imm8});
+        const detail::VectorMovPlan plan = detail::plan_vector_mov(bits * std::uint64_t{0x0000'0001'0000'0001});
+        if (plan.kind == detail::VectorMovPlan::Kind::Literal)
+            return LDR(sd, literal64(bits));
+        const DReg dd = sd.toD();
+        emit_vector_mov(dd, dd.B8(), dd.H4(), dd.S2(), plan);
+    }
+
+    constexpr void FMOV(DReg dd, double value)
+    {
+        const std::uint64_t bits = std::bit_cast<std::uint64_t>(value);
+        if (const auto imm8 = detail::encode_fp_imm8(bits))
+            return FMOV(dd, FImm8{*imm8});
+        MOV(dd, bits);
+    }
+
+    // As above, but a value that would be loaded from the literal pool is instead materialized in scratch with MOV
+    // and moved over with FMOV (general) or DUP (general). scratch is only written in that case.
+    constexpr void MOV(DReg dd, std::uint64_t imm, XReg scratch)
+    {
+        const detail::VectorMovPlan plan = detail::plan_vector_mov(imm);
+        if (plan.kind != detail::VectorMovPlan::Kind::Literal)
+            return emit_vector_mov(dd, dd.B8(), dd.H4(), dd.S2(), plan);
+        MOV(scratch, imm);
+        FMOV(dd, scratch);
+    }
+
+    constexpr void MOV(QReg qd, std::uint64_t lo, std::uint64_t hi, XReg scratch)
+    {
+        if (hi == 0)
+            return MOV(qd.toD(), lo, scratch);
+        if (lo == hi) {
+            const detail::VectorMovPlan plan = detail::plan_vector_mov(lo);
+            if (plan.kind != detail::VectorMovPlan::Kind::Literal)
+                return emit_vector_mov(qd.D2(), qd.B16(), qd.H8(), qd.S4(), plan);
+            MOV(scratch, lo);
+            return DUP(qd.D2(), scratch);
+        }
+        MOV(qd.toD(), lo, scratch);
+        MOV(scratch, hi);
+        FMOV(qd.Delem()[1], scratch);
+    }
+
+    constexpr void FMOV(SReg sd, float value, WReg scratch)
+    {
+        const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+        if (const auto imm8 = detail::encode_fp_imm8(bits))
+            return FMOV(sd, FImm8{*imm8});
+        const detail::VectorMovPlan plan = detail::plan_vector_mov(bits * std::uint64_t{0x0000'0001'0000'0001});
+        if (plan.kind == detail::VectorMovPlan::Kind::Literal) {
+            MOV(scratch, bits);
+            return FMOV(sd, scratch);
         }
+        const DReg dd = sd.toD();
+        emit_vector_mov(dd, dd.B8(), dd.H4(), dd.S2(), plan);
+    }
+
+    constexpr void FMOV(DReg dd, double value, XReg scratch)
+    {
+        const std::uint64_t bits = std::bit_cast<std::uint64_t>(value);
+        if (const auto imm8 = detail::encode_fp_imm8(bits))
+            return FMOV(dd, FImm8{*imm8});
+        MOV(dd, bits, scratch);
     }
 
     // Convenience function for moving pointers to registers
     void MOVP2R(XReg xd, const void* addr)
     {
+        if (m_relocation_recording) {
+            // Appended directly, so that no island can separate the four instructions.
+            prepare_append(4 * sizeof(std::uint32_t));
+            const auto imm = reinterpret_cast<std::uint64_t>(addr);
+            add_relocation(RelocationKind::MovAbs64, false, imm);
+            for (std::uint32_t i = 0; i < 4; i++)
+                Policy::append((i == 0 ? 0xD280'0000 : 0xF280'0000) | i << 21 | (static_cast<std::uint32_t>(imm >> (16 * i)) & 0xFFFF) << 5 | xd.index());
+            return;
+        }
+
         const int64_t diff = reinterpret_cast<std::uint64_t>(addr) - Policy::template xptr<std::uintptr_t>();
         if (diff >= -0xF'FFFF && diff <= 0xF'FFFF) {
             ADR(xd, addr);
@@ -170,37 +392,394 @@ public:
         }
     }
 
-    void align(std::size_t alignment)
+    constexpr void align(std::size_t alignment)
     {
         if (alignment < 4 || (alignment & (alignment - 1)) != 0)
-            throw OaknutException{ExceptionType::InvalidAlignment};
+            return detail::report_error(ExceptionType::InvalidAlignment);
 
         while (Policy::offset() & (alignment - 1)) {
             NOP();
         }
     }
 
-    void dw(std::uint32_t value)
+    // Emits a copy of the words of stencil, with its holes filled in order from args. Label holes behave as the
+    // corresponding instruction operands, except that out of range branches are not relaxed.
+    // The holes are expanded at compile time, so that emission is a copy of the words and an OR per value hole.
+    template<auto stencil>
+    constexpr void emit_stencil(const std::array<StencilArg, stencil.holes.size()>& args)
+    {
+        constexpr std::size_t N = stencil.words.size();
+        constexpr std::size_t H = stencil.holes.size();
+
+        prepare_append(N * sizeof(std::uint32_t));
+
+        std::array<std::uint32_t, N> words = stencil.words;
+        const bool valid = [&]<std::size_t... i>(std::index_sequence<i...>) {
+            const std::uint32_t invalid = (std::uint32_t{0} | ... | stencil_hole_invalid<stencil.holes[i].field>(args[i]));
+            (fill_stencil_hole<stencil.holes[i]>(words, args[i]), ...);
+            return invalid == 0;
+        }(std::make_index_sequence<H>{});
+        if (!valid && !report_stencil_error<stencil>(args)) [[unlikely]]
+            return;
+
+        const std::ptrdiff_t base = Policy::offset();
+        Policy::append(words.data(), N);
+
+        [&]<std::size_t... i>(std::index_sequence<i...>) {
+            (fixup_stencil_hole<stencil.holes[i]>(base, args[i]), ...);
+        }(std::make_index_sequence<H>{});
+    }
+
+    // Emits an island now if one would otherwise be due within the next size bytes, so that the code and data emitted
+    // in them are contiguous, as a sequence addressed relative to its own start must be. size must be small next to
+    // the 4 KiB ahead of their deadline at which islands are emitted.
+    constexpr void reserve_contiguous(std::size_t size)
     {
+        prepare_append(size);
+    }
+
+    // As with instructions, an island may be emitted before data if one is due, so a run of data (such as a jump
+    // table) is only contiguous if no branch or literal pending before it would go out of range within it.
+    constexpr void dw(std::uint32_t value)
+    {
+        prepare_append(sizeof(std::uint32_t));
         Policy::append(value);
     }
 
-    void dx(std::uint64_t value)
+    constexpr void dx(std::uint64_t value)
     {
-        Policy::append(static_cast<std::uint32_t>(value));
-        Policy::append(static_cast<std::uint32_t>(value >> 32));
+        prepare_append(sizeof(std::uint64_t));
+        append_doubleword(value);
+    }
+
+    // Emits the absolute executable address of label.
+    constexpr void dx(Label& label)
+    {
+        prepare_append(sizeof(std::uint64_t));
+        if (!label.is_bound()) {
+            add_fixup(label, detail::FixupKind::Abs64);
+            return append_doubleword(0);
+        }
+        if (m_relocation_recording)
+            add_relocation(RelocationKind::Abs64, true, static_cast<std::uint64_t>(label.offset()));
+        append_doubleword(Policy::template xptr<std::uintptr_t>() - Policy::offset() + label.offset());
     }
 
 private:
 #include "oaknut/impl/arm64_encode_helpers.inc.hpp"
 
     template<StringLiteral bs, StringLiteral... bargs, typename... Ts>
-    void emit(Ts... args)
+    constexpr void emit(Ts... args)
     {
+        if (Policy::offset() >= m_island_deadline) [[unlikely]]
+            emit_island();
+
         constexpr std::uint32_t base = detail::find<bs, "1">();
+        if constexpr (detail::is_short_branch(base)) {
+            if (m_branch_relaxation) [[unlikely]] {
+                Label* far = nullptr;
+                ((far = far ? far : far_label(args)), ...);
+                if (far) {
+                    // The skip and the B are appended together, as an island between them would be skipped into.
+                    // An island only moves the B farther from the bound label, which stays out of range.
+                    prepare_append(2 * sizeof(std::uint32_t));
+                    const std::uint32_t skip = (base | ... | encode<detail::find<bs, bargs>()>(skip_offset(args)));
+                    if (!detail::is_unconditional_short_branch(skip))
+                        Policy::append(detail::invert_short_branch(skip));
+
+                    constexpr std::uint32_t b = detail::find<"000101iiiiiiiiiiiiiiiiiiiiiiiiii", "1">();
+                    Policy::append(b | encode<detail::find<"000101iiiiiiiiiiiiiiiiiiiiiiiiii", "i">()>(AddrOffset<28, 2>{*far}));
+                    return;
+                }
+            }
+        }
+
         std::uint32_t encoding = (base | ... | encode<detail::find<bs, bargs>()>(std::forward<Ts>(args)));
         Policy::append(encoding);
     }
+
+    // Nonzero if arg does not fit the hole field.
+    template<StencilField field>
+    static constexpr std::uint32_t stencil_hole_invalid(const StencilArg& arg)
+    {
+        if constexpr (field.is_label)
+            return arg.label == nullptr;
+        else
+            return (arg.value >> field.width) | (arg.label != nullptr);
+    }
+
+    template<StencilHole hole, std::size_t N>
+    static constexpr void fill_stencil_hole(std::array<std::uint32_t, N>& words, const StencilArg& arg)
+    {
+        if constexpr (!hole.field.is_label)
+            words[hole.word] |= (arg.value << hole.field.shift) & hole.field.mask();
+    }
+
+    template<StencilHole hole>
+    constexpr void fixup_stencil_hole(std::ptrdiff_t base, const StencilArg& arg)
+    {
+        if constexpr (hole.field.is_label) {
+            const detail::Fixup fixup{base + static_cast<std::ptrdiff_t>(hole.word * sizeof(std::uint32_t)), hole.field.label_kind};
+            if (arg.label->is_bound())
+                apply_fixup(fixup, arg.label->offset());
+            else
+                add_fixup(*arg.label, fixup);
+        }
+    }
+
+    // Reports the first invalid argument. Returns whether the stencil can still be emitted, with values truncated.
+    template<auto stencil>
+    OAKNUT_COLD static constexpr bool report_stencil_error(const std::array<StencilArg, stencil.holes.size()>& args)
+    {
+        for (std::size_t i = 0; i < args.size(); i++) {
+            if (stencil.holes[i].field.is_label != (args[i].label != nullptr)) {
+                detail::report_error(ExceptionType::InvalidStencilArgument);
+                return false;
+            }
+        }
+        detail::report_error(ExceptionType::ImmOutOfRange);
+        return true;
+    }
+
+    // Emits an island first if one is due before size bytes can be appended without one.
+    constexpr void prepare_append(std::size_t size)
+    {
+        const auto lookahead = static_cast<std::ptrdiff_t>(size - sizeof(std::uint32_t));
+        if (Policy::offset() + lookahead >= m_island_deadline) [[unlikely]]
+            emit_island(lookahead);
+    }
+
+    constexpr void append_doubleword(std::uint64_t value)
+    {
+        Policy::append(static_cast<std::uint32_t>(value));
+        Policy::append(static_cast<std::uint32_t>(value >> 32));
+    }
+
+    constexpr void add_fixup(Label& label, detail::FixupKind kind)
+    {
+        add_fixup(label, detail::Fixup{Policy::offset(), kind});
+    }
+
+    constexpr void add_fixup(Label& label, const detail::Fixup& fixup)
+    {
+        if (label.m_handle == detail::FixupTable::npos)
+            label.m_handle = m_fixups.acquire();
+        m_fixups.add(label.m_handle, fixup);
+
+        if (const std::ptrdiff_t reach = detail::max_short_branch_offset(fixup.kind); m_branch_relaxation && reach != 0) {
+            m_branch_deadline = std::min(m_branch_deadline, fixup.offset + reach);
+            m_pending_branches++;
+            m_island_deadline = island_deadline();
+        }
+    }
+
+    // Out of line, so that the opt-in recording does not weigh on the encoding of every PC-relative operand.
+    OAKNUT_COLD constexpr void add_relocation(RelocationKind kind, bool internal, std::uint64_t target)
+    {
+        m_relocations.push_back(Relocation{Policy::offset(), kind, internal, target});
+    }
+
+    template<typename T>
+    static constexpr Label* far_label(const T&)
+    {
+        return nullptr;
+    }
+
+    template<std::size_t size, std::size_t align>
+    constexpr Label* far_label(const AddrOffset<size, align>& v) const
+    {
+        if (v.m_payload.kind != detail::OffsetPayload::Kind::Label || !v.m_payload.label->is_bound())
+            return nullptr;
+        const auto diff = static_cast<std::uint64_t>(v.m_payload.label->offset() - Policy::offset());
+        return detail::sign_extend<size>(diff) == diff ? nullptr : v.m_payload.label;
+    }
+
+    template<typename T>
+    static constexpr T skip_offset(T v)
+    {
+        return v;
+    }
+
+    template<std::size_t size, std::size_t align>
+    static constexpr AddrOffset<size, align> skip_offset(const AddrOffset<size, align>&)
+    {
+        return AddrOffset<size, align>{std::ptrdiff_t{8}};
+    }
+
+    constexpr Label& add_literal(const detail::Literal& literal)
+    {
+        if (m_literals.empty())
+            m_literal_base = Policy::offset();
+
+        const std::size_t index = m_literals.insert(literal);
+        if (index == m_literal_labels.size())
+            m_literal_labels.emplace_back();
+
+        m_island_deadline = island_deadline();
+        return m_literal_labels[index];
+    }
+
+    // vd is either the DReg (64-bit) or VReg_2D (128-bit) view of the destination, vb, vh and vs the matching arrangements.
+    template<typename VD, typename VB, typename VH, typename VS>
+    constexpr void emit_vector_mov(VD vd, VB vb, VH vh, VS vs, const detail::VectorMovPlan& plan)
+    {
+        using Kind = detail::VectorMovPlan::Kind;
+
+        switch (plan.kind) {
+        case Kind::MoviRep:
+            return MOVI(vd, RepImm{plan.imm});
+        case Kind::Movi8:
+            return MOVI(vb, plan.imm);
+        case Kind::Movi16:
+            return MOVI(vh, plan.imm, LslSymbol::LSL, plan.shift);
+        case Kind::Mvni16:
+            return MVNI(vh, plan.imm, LslSymbol::LSL, plan.shift);
+        case Kind::Movi32:
+            return MOVI(vs, plan.imm, LslSymbol::LSL, plan.shift);
+        case Kind::Mvni32:
+            return MVNI(vs, plan.imm, LslSymbol::LSL, plan.shift);
+        case Kind::Movi32Msl:
+            return MOVI(vs, plan.imm, MslSymbol::MSL, plan.shift);
+        case Kind::Mvni32Msl:
+            return MVNI(vs, plan.imm, MslSymbol::MSL, plan.shift);
+        case Kind::Fmov32:
+            return FMOV(vs, FImm8{plan.imm});
+        case Kind::Fmov64:
+            return FMOV(vd, FImm8{plan.imm});
+        case Kind::Movi16Orr:
+            MOVI(vh, plan.imm, LslSymbol::LSL, plan.shift);
+            return ORR(vh, plan.imm2, LslSymbol::LSL, plan.shift2);
+        case Kind::Movi32Orr:
+            MOVI(vs, plan.imm, LslSymbol::LSL, plan.shift);
+            return ORR(vs, plan.imm2, LslSymbol::LSL, plan.shift2);
+        case Kind::Mvni32Bic:
+            MVNI(vs, plan.imm, LslSymbol::LSL, plan.shift);
+            return BIC(vs, plan.imm2, LslSymbol::LSL, plan.shift2);
+        case Kind::Literal:
+            break;
+        }
+    }
+
+    constexpr void emit_literal_pool()
+    {
+        if (m_literals.empty())
+            return;
+
+        const std::size_t alignment = m_literals.has_wide() ? 16 : 8;
+        while (Policy::template xptr<std::uintptr_t>() % alignment != 0)
+            Policy::append(0);
+
+        const auto& literals = m_literals.literals();
+        for (bool wide : {true, false}) {
+            for (std::size_t i = 0; i < literals.size(); i++) {
+                if (literals[i].wide != wide)
+                    continue;
+                l(m_literal_labels[i]);
+                append_doubleword(literals[i].lo);
+                if (wide)
+                    append_doubleword(literals[i].hi);
+            }
+        }
+
+        for (std::size_t i = 0; i < literals.size(); i++)
+            m_literal_labels[i].m_offset.reset();
+        m_literals.clear();
+    }
+
+    constexpr bool is_pending_short_branch(const detail::Fixup& fixup) const
+    {
+        return detail::max_short_branch_offset(fixup.kind) != 0 && detail::is_short_branch(Policy::get_at_offset(fixup.offset));
+    }
+
+    // Maximum size of an island excluding its literals: a veneer for every pending branch, a branch over the veneers,
+    // a branch over the literals, and alignment padding.
+    constexpr std::ptrdiff_t island_overhead() const
+    {
+        return static_cast<std::ptrdiff_t>(sizeof(std::uint32_t) * (m_pending_branches + 2) + 16);
+    }
+
+    constexpr std::ptrdiff_t literal_deadline() const
+    {
+        if (m_literals.empty())
+            return no_deadline;
+        const std::ptrdiff_t reach = detail::max_short_branch_offset(detail::FixupKind::Imm19);
+        return m_literal_base + reach - island_overhead() - static_cast<std::ptrdiff_t>(m_literals.size_in_bytes());
+    }
+
+    constexpr std::ptrdiff_t island_deadline() const
+    {
+        if (m_branch_deadline == no_deadline)
+            return literal_deadline();
+        return std::min(m_branch_deadline - island_overhead(), literal_deadline());
+    }
+
+    constexpr void update_island_deadline()
+    {
+        m_branch_deadline = no_deadline;
+        m_pending_branches = 0;
+        if (m_branch_relaxation) {
+            m_fixups.for_each_pending([&](const detail::Fixup& fixup) {
+                if (is_pending_short_branch(fixup)) {
+                    m_branch_deadline = std::min(m_branch_deadline, fixup.offset + detail::max_short_branch_offset(fixup.kind));
+                    m_pending_branches++;
+                }
+            });
+        }
+        m_island_deadline = island_deadline();
+    }
+
+    // Redirects every pending short branch that would otherwise go out of range soon through a veneer,
+    // then emits the literal pool if a load referencing it would otherwise go out of range within lookahead bytes.
+    OAKNUT_COLD constexpr void emit_island(std::ptrdiff_t lookahead = 0)
+    {
+        constexpr std::ptrdiff_t horizon = 4096;
+        constexpr std::uint32_t b = 0x1400'0000;
+
+        const bool flush = Policy::offset() + lookahead >= literal_deadline();
+
+        if (m_branch_relaxation) {
+            const std::ptrdiff_t start = Policy::offset();
+            const std::ptrdiff_t limit = start + island_overhead() + horizon + (flush ? static_cast<std::ptrdiff_t>(m_literals.size_in_bytes()) : 0);
+
+            bool emitted = false;
+            m_fixups.for_each_pending([&](detail::Fixup& fixup) {
+                if (!is_pending_short_branch(fixup) || fixup.offset + detail::max_short_branch_offset(fixup.kind) >= limit)
+                    return;
+                if (!emitted) {
+                    Policy::append(b);
+                    emitted = true;
+                }
+                const std::ptrdiff_t veneer = Policy::offset();
+                apply_fixup(fixup, veneer);
+                Policy::append(b);
+                fixup = detail::Fixup{veneer, detail::FixupKind::Imm26};
+            });
+            if (emitted)
+                apply_fixup(detail::Fixup{start, detail::FixupKind::Imm26}, Policy::offset());
+        }
+
+        if (flush) {
+            const std::ptrdiff_t start = Policy::offset();
+            Policy::append(b);
+            emit_literal_pool();
+            apply_fixup(detail::Fixup{start, detail::FixupKind::Imm26}, Policy::offset());
+        }
+
+        update_island_deadline();
+    }
+
+    static constexpr std::ptrdiff_t no_deadline = std::numeric_limits<std::ptrdiff_t>::max();
+
+    detail::FixupTable m_fixups;
+    bool m_branch_relaxation = false;
+    std::ptrdiff_t m_island_deadline = no_deadline;
+    std::ptrdiff_t m_branch_deadline = no_deadline;  // earliest offset a pending short branch can no longer reach
+    std::size_t m_pending_branches = 0;              // upper bound on the number of pending short branches
+    detail::LiteralPool m_literals;
+    detail::StableVector<Label> m_literal_labels;  // indexed as m_literals; labels are recycled after each flush
+    std::ptrdiff_t m_literal_base = 0;             // offset of the first reference to the pending literals
+    bool m_relocation_recording = false;
+    std::vector<Relocation> m_relocations;
 };
 
 struct PointerCodeGeneratorPolicy {
@@ -213,8 +792,8 @@ public:
     void set_offset(std::ptrdiff_t offset)
     {
         if ((offset % sizeof(std::uint32_t)) != 0)
-            throw OaknutException{ExceptionType::InvalidAlignment};
-        m_ptr = m_wmem + offset / sizeof(std::uint32_t);
+            return detail::report_error(ExceptionType::InvalidAlignment);
+        move_to(m_wmem + offset / sizeof(std::uint32_t));
     }
 
     template<typename T>
@@ -233,12 +812,36 @@ public:
 
     void set_wptr(std::uint32_t* p)
     {
-        m_ptr = p;
+        move_to(p);
     }
 
     void set_xptr(std::uint32_t* p)
     {
-        m_ptr = m_wmem + (p - m_xmem);
+        move_to(m_wmem + (p - m_xmem));
+    }
+
+    // While enabled, the executable address ranges written to (including by fixups) are recorded, so that only they
+    // need be invalidated: mem.invalidate(code.dirty_ranges()) followed by code.clear_dirty_ranges().
+    void set_dirty_tracking(bool enabled)
+    {
+        if (m_dirty_tracking)
+            close_dirty_span();
+        m_dirty_tracking = enabled;
+        m_span_begin = m_ptr;
+    }
+
+    // Normalized ranges written since tracking was enabled or the ranges were last cleared.
+    const DirtyRanges& dirty_ranges()
+    {
+        close_dirty_span();
+        m_dirty.normalize();
+        return m_dirty;
+    }
+
+    void clear_dirty_ranges()
+    {
+        m_dirty.clear();
+        m_span_begin = m_ptr;
     }
 
 protected:
@@ -253,16 +856,213 @@ protected:
         *m_ptr++ = instruction;
     }
 
-    void set_at_offset(std::ptrdiff_t offset, std::uint32_t value, std::uint32_t mask) const
+    void append(const std::uint32_t* words, std::size_t count)
+    {
+        m_ptr = std::copy_n(words, count, m_ptr);
+    }
+
+    void set_at_offset(std::ptrdiff_t offset, std::uint32_t value, std::uint32_t mask)
     {
         std::uint32_t* p = m_wmem + offset / sizeof(std::uint32_t);
         *p = (*p & mask) | value;
+        if (m_dirty_tracking && (p < m_span_begin || p >= m_ptr))
+            m_dirty.add(m_xmem + (p - m_wmem), sizeof(std::uint32_t));
+    }
+
+    std::uint32_t get_at_offset(std::ptrdiff_t offset) const
+    {
+        return m_wmem[offset / sizeof(std::uint32_t)];
     }
 
 private:
+    // Words are appended contiguously from m_span_begin, so the current span is only recorded once it ends.
+    void close_dirty_span()
+    {
+        if (m_dirty_tracking && m_ptr > m_span_begin)
+            m_dirty.add(m_xmem + (m_span_begin - m_wmem), (m_ptr - m_span_begin) * sizeof(std::uint32_t));
+        m_span_begin = m_ptr;
+    }
+
+    void move_to(std::uint32_t* p)
+    {
+        close_dirty_span();
+        m_ptr = m_span_begin = p;
+    }
+
     std::uint32_t* m_ptr;
     std::uint32_t* const m_wmem;
     std::uint32_t* const m_xmem;
+
+    bool m_dirty_tracking = false;
+    std::uint32_t* m_span_begin = nullptr;
+    DirtyRanges m_dirty;
+};
+
+// A block of memory for BoundedCodeGenerator: capacity words written through wmem and executed from xmem.
+struct CodeRegion {
+    std::uint32_t* wmem;
+    std::uint32_t* xmem;
+    std::size_t capacity;
+};
+
+// Called by BoundedCodeGenerator when its region is full. Returns the region to continue in, which is linked to from
+// the last word of the full region with a B, or std::nullopt to report CodeBufferFull. It may also throw to abandon emission.
+using OverflowHandler = std::function<std::optional<CodeRegion>()>;
+
+// Offsets are those of execution addresses relative to the start of the first region, so that PC-relative references
+// remain correct across chained regions as long as their targets are in range.
+struct BoundedCodeGeneratorPolicy {
+public:
+    std::ptrdiff_t offset() const
+    {
+        return m_base + (m_ptr - m_wmem) * static_cast<std::ptrdiff_t>(sizeof(std::uint32_t));
+    }
+
+    /// Only offsets within the current region can be set.
+    void set_offset(std::ptrdiff_t offset)
+    {
+        if ((offset % sizeof(std::uint32_t)) != 0)
+            return detail::report_error(ExceptionType::InvalidAlignment);
+        if (offset < m_base || offset > m_base + (m_end - m_wmem) * static_cast<std::ptrdiff_t>(sizeof(std::uint32_t)))
+            return detail::report_error(ExceptionType::OffsetOutOfRange);
+        m_ptr = m_wmem + (offset - m_base) / static_cast<std::ptrdiff_t>(sizeof(std::uint32_t));
+    }
+
+    template<typename T>
+    T wptr() const
+    {
+        static_assert(std::is_pointer_v<T> || std::is_same_v<T, std::uintptr_t> || std::is_same_v<T, std::intptr_t>);
+        return reinterpret_cast<T>(m_ptr);
+    }
+
+    template<typename T>
+    T xptr() const
+    {
+        static_assert(std::is_pointer_v<T> || std::is_same_v<T, std::uintptr_t> || std::is_same_v<T, std::intptr_t>);
+        return reinterpret_cast<T>(m_xmem + (m_ptr - m_wmem));
+    }
+
+    /// Words that can still be emitted before the overflow handler is called.
+    std::size_t remaining() const
+    {
+        return static_cast<std::size_t>(m_end - m_ptr);
+    }
+
+    /// The last word of each region is reserved for the link to the next while a handler is set.
+    void set_overflow_handler(OverflowHandler handler)
+    {
+        m_handler = std::move(handler);
+        update_end();
+    }
+
+protected:
+    using constructor_argument_type = const CodeRegion&;
+
+    BoundedCodeGeneratorPolicy(const CodeRegion& region, std::uint32_t*)
+        : m_ptr(region.wmem), m_wmem(region.wmem), m_xmem(region.xmem), m_capacity(region.capacity), m_xorigin(region.xmem)
+    {
+        update_end();
+    }
+
+    void append(std::uint32_t instruction)
+    {
+        if (m_ptr == m_end) [[unlikely]] {
+            if (!next_region())
+                return;
+        }
+        *m_ptr++ = instruction;
+    }
+
+    void append(const std::uint32_t* words, std::size_t count)
+    {
+        if (count > remaining()) [[unlikely]] {
+            // Continue in the next region early, so that the words are not split by the link.
+            if (!next_region())
+                return;
+            if (count > remaining()) {
+                for (std::size_t i = 0; i < count; i++)
+                    append(words[i]);
+                return;
+            }
+        }
+        m_ptr = std::copy_n(words, count, m_ptr);
+    }
+
+    void set_at_offset(std::ptrdiff_t offset, std::uint32_t value, std::uint32_t mask) const
+    {
+        if (std::uint32_t* p = word_at(offset))
+            *p = (*p & mask) | value;
+    }
+
+    std::uint32_t get_at_offset(std::ptrdiff_t offset) const
+    {
+        const std::uint32_t* p = word_at(offset);
+        return p ? *p : 0;
+    }
+
+private:
+    struct PastRegion {
+        std::ptrdiff_t begin;
+        std::ptrdiff_t end;
+        std::uint32_t* wmem;
+    };
+
+    void update_end()
+    {
+        m_end = m_wmem + m_capacity;
+        if (m_handler && m_ptr != m_end)
+            m_end--;
+    }
+
+    // Reports OffsetOutOfRange and returns nullptr if offset is not within any region.
+    std::uint32_t* word_at(std::ptrdiff_t offset) const
+    {
+        constexpr auto word_size = static_cast<std::ptrdiff_t>(sizeof(std::uint32_t));
+        if (offset >= m_base && offset < m_base + static_cast<std::ptrdiff_t>(m_capacity) * word_size) [[likely]]
+            return m_wmem + (offset - m_base) / word_size;
+        for (auto it = m_past_regions.rbegin(); it != m_past_regions.rend(); ++it) {
+            if (offset >= it->begin && offset < it->end)
+                return it->wmem + (offset - it->begin) / word_size;
+        }
+        detail::report_error(ExceptionType::OffsetOutOfRange);
+        return nullptr;
+    }
+
+    OAKNUT_COLD bool next_region()
+    {
+        const bool can_link = m_handler && m_ptr != m_wmem + m_capacity;
+        const std::optional<CodeRegion> region = can_link ? m_handler() : std::nullopt;
+        if (!region) {
+            detail::report_error(ExceptionType::CodeBufferFull);
+            return false;
+        }
+
+        const auto from = reinterpret_cast<std::uintptr_t>(m_xmem + (m_ptr - m_wmem));
+        const auto diff = static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(region->xmem) - from);
+        if (diff < -(std::ptrdiff_t{1} << 27) || diff >= (std::ptrdiff_t{1} << 27)) {
+            detail::report_error(ExceptionType::OffsetOutOfRange);
+            return false;
+        }
+        *m_ptr++ = 0x1400'0000 | static_cast<std::uint32_t>((diff >> 2) & 0x03FF'FFFF);
+
+        m_past_regions.push_back(PastRegion{m_base, offset(), m_wmem});
+        m_base = static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(region->xmem) - reinterpret_cast<std::uintptr_t>(m_xorigin));
+        m_ptr = m_wmem = region->wmem;
+        m_xmem = region->xmem;
+        m_capacity = region->capacity;
+        update_end();
+        return m_ptr != m_end || next_region();
+    }
+
+    std::uint32_t* m_ptr;
+    std::uint32_t* m_end;
+    std::uint32_t* m_wmem;
+    std::uint32_t* m_xmem;
+    std::size_t m_capacity;
+    std::ptrdiff_t m_base = 0;  // offset of the start of the current region
+    std::uint32_t* const m_xorigin;
+    OverflowHandler m_handler;
+    std::vector<PastRegion> m_past_regions;
 };
 
 struct VectorCodeGeneratorPolicy {
@@ -291,17 +1091,140 @@ protected:
         m_vec.push_back(instruction);
     }
 
+    void append(const std::uint32_t* words, std::size_t count)
+    {
+        m_vec.insert(m_vec.end(), words, words + count);
+    }
+
     void set_at_offset(std::ptrdiff_t offset, std::uint32_t value, std::uint32_t mask) const
     {
         std::uint32_t& p = m_vec[offset / sizeof(std::uint32_t)];
         p = (p & mask) | value;
     }
 
+    std::uint32_t get_at_offset(std::ptrdiff_t offset) const
+    {
+        return m_vec[offset / sizeof(std::uint32_t)];
+    }
+
 private:
     std::vector<std::uint32_t>& m_vec;
     std::uint32_t* const m_xmem;
 };
 
+template<typename Allocator>
+struct SegmentedCodeGeneratorPolicy {
+public:
+    std::ptrdiff_t offset() const
+    {
+        return m_buffer.size() * sizeof(std::uint32_t);
+    }
+
+    template<typename T>
+    T xptr() const
+    {
+        static_assert(std::is_pointer_v<T> || std::is_same_v<T, std::uintptr_t> || std::is_same_v<T, std::intptr_t>);
+        return reinterpret_cast<T>(m_xmem + m_buffer.size());
+    }
+
+protected:
+    using constructor_argument_type = SegmentedBuffer<Allocator>&;
+
+    SegmentedCodeGeneratorPolicy(SegmentedBuffer<Allocator>& buffer, std::uint32_t* xmem)
+        : m_buffer(buffer), m_xmem(xmem)
+    {}
+
+    void append(std::uint32_t instruction)
+    {
+        m_buffer.append(instruction);
+    }
+
+    void append(const std::uint32_t* words, std::size_t count)
+    {
+        m_buffer.append(words, count);
+    }
+
+    void set_at_offset(std::ptrdiff_t offset, std::uint32_t value, std::uint32_t mask) const
+    {
+        std::uint32_t& p = m_buffer[offset / sizeof(std::uint32_t)];
+        p = (p & mask) | value;
+    }
+
+    std::uint32_t get_at_offset(std::ptrdiff_t offset) const
+    {
+        return std::as_const(m_buffer)[offset / sizeof(std::uint32_t)];
+    }
+
+private:
+    SegmentedBuffer<Allocator>& m_buffer;
+    std::uint32_t* const m_xmem;
+};
+
+// Emits into a fixed-size array held by the generator itself, for use in constant evaluation (see assemble()).
+// No executable address is known: offsets are relative to the start of the array, and operands that refer to
+// absolute addresses cannot be used. Literals are aligned relative to the start of the array.
+template<std::size_t N>
+struct ArrayCodeGeneratorPolicy {
+public:
+    constexpr std::ptrdiff_t offset() const
+    {
+        return static_cast<std::ptrdiff_t>(m_size * sizeof(std::uint32_t));
+    }
+
+    template<typename T>
+    constexpr T xptr() const
+    {
+        static_assert(std::is_same_v<T, std::uintptr_t> || std::is_same_v<T, std::intptr_t>);
+        return static_cast<T>(offset());
+    }
+
+    /// Number of words emitted.
+    constexpr std::size_t size() const
+    {
+        return m_size;
+    }
+
+    constexpr const std::array<std::uint32_t, N>& words() const
+    {
+        return m_words;
+    }
+
+protected:
+    using constructor_argument_type = std::nullptr_t;
+
+    constexpr ArrayCodeGeneratorPolicy(std::nullptr_t, std::uint32_t*) {}
+
+    constexpr void append(std::uint32_t instruction)
+    {
+        if (m_size == N) [[unlikely]]
+            return detail::report_error(ExceptionType::CodeBufferFull);
+        m_words[m_size++] = instruction;
+    }
+
+    constexpr void append(const std::uint32_t* words, std::size_t count)
+    {
+        if (count > N - m_size) [[unlikely]]
+            return detail::report_error(ExceptionType::CodeBufferFull);
+        std::copy_n(words, count, m_words.begin() + m_size);
+        m_size += count;
+    }
+
+    constexpr void set_at_offset(std::ptrdiff_t offset, std::uint32_t value, std::uint32_t mask)
+    {
+        std::uint32_t& p = m_words[offset / sizeof(std::uint32_t)];
+        p = (p & mask) | value;
+    }
+
+    constexpr std::uint32_t get_at_offset(std::ptrdiff_t offset) const
+    {
+        return m_words[offset / sizeof(std::uint32_t)];
+    }
+
+private:
+    std::array<std::uint32_t, N> m_words{};
+    std::size_t m_size = 0;
+};
+
 struct CodeGenerator : BasicCodeGenerator<PointerCodeGeneratorPolicy> {
 public:
     CodeGenerator(std::uint32_t* mem)
@@ -310,6 +1233,14 @@ public:
         : BasicCodeGenerator<PointerCodeGeneratorPolicy>(wmem, xmem) {}
 };
 
+struct BoundedCodeGenerator : BasicCodeGenerator<BoundedCodeGeneratorPolicy> {
+public:
+    BoundedCodeGenerator(std::uint32_t* mem, std::size_t capacity)
+        : BasicCodeGenerator<BoundedCodeGeneratorPolicy>(CodeRegion{mem, mem, capacity}, mem) {}
+    BoundedCodeGenerator(std::uint32_t* wmem, std::uint32_t* xmem, std::size_t capacity)
+        : BasicCodeGenerator<BoundedCodeGeneratorPolicy>(CodeRegion{wmem, xmem, capacity}, xmem) {}
+};
+
 struct VectorCodeGenerator : BasicCodeGenerator<VectorCodeGeneratorPolicy> {
 public:
     VectorCodeGenerator(std::vector<std::uint32_t>& mem)
@@ -318,6 +1249,54 @@ public:
         : BasicCodeGenerator<VectorCodeGeneratorPolicy>(wmem, xmem) {}
 };
 
+template<typename Allocator = std::allocator<std::uint32_t>>
+struct SegmentedCodeGenerator : BasicCodeGenerator<SegmentedCodeGeneratorPolicy<Allocator>> {
+public:
+    SegmentedCodeGenerator(SegmentedBuffer<Allocator>& mem)
+        : BasicCodeGenerator<SegmentedCodeGeneratorPolicy<Allocator>>(mem, nullptr) {}
+    SegmentedCodeGenerator(SegmentedBuffer<Allocator>& wmem, std::uint32_t* xmem)
+        : BasicCodeGenerator<SegmentedCodeGeneratorPolicy<Allocator>>(wmem, xmem) {}
+};
+
+template<std::size_t N>
+struct ArrayCodeGenerator : BasicCodeGenerator<ArrayCodeGeneratorPolicy<N>> {
+public:
+    constexpr ArrayCodeGenerator()
+        : BasicCodeGenerator<ArrayCodeGeneratorPolicy<N>>(nullptr, nullptr) {}
+};
+
+// Encodes a fixed instruction sequence at compile time: f is called with an ArrayCodeGenerator<N>&, and must emit
+// exactly N words. Any error, including an invalid operand, is a compile error.
+// The result is position-independent only if f uses no absolute addresses, and can be copied into place with memcpy.
+template<std::size_t N, typename F>
+consteval std::array<std::uint32_t, N> assemble(F f)
+{
+    ArrayCodeGenerator<N> code;
+    f(code);
+    if (code.size() != N)
+        detail::report_error(ExceptionType::AssembledSizeMismatch);
+    return code.words();
+}
+
+// Builds a Stencil at compile time: its words are assemble<N>(f), and its holes are as given, in the order of the
+// arguments of emit_stencil. The operands f uses for holes are placeholders; any value that encodes will do.
+template<std::size_t N, typename F, typename... Holes>
+consteval Stencil<N, sizeof...(Holes)> make_stencil(F f, Holes... holes)
+{
+    Stencil<N, sizeof...(Holes)> result{{}, {StencilHole(holes)...}};
+    result.words = assemble<N>(f);
+    for (const StencilHole& hole : result.holes) {
+        if (hole.word >= N)
+            detail::report_error(ExceptionType::InvalidStencilArgument);
+        if (!hole.field.is_label) {
+            if (hole.field.width == 0 || hole.field.width >= 32 || hole.field.shift + hole.field.width > 32)
+                detail::report_error(ExceptionType::InvalidStencilArgument);
+            result.words[hole.word] &= ~hole.field.mask();
+        }
+    }
+    return result;
+}
+
 namespace util {
 
 inline constexpr WReg W0{0}, W1{1}, W2{2}, W3{3}, W4{4}, W5{5}, W6{6}, W7{7}, W8{8}, W9{9}, W10{10}, W11{11}, W12{12}, W13{13}, W14{14}, W15{15}, W16{16}, W17{17}, W18{18}, W19{19}, W20{20}, W21{21}, W22{22}, W23{23}, W24{24}, W25{25}, W26{26}, W27{27}, W28{28}, W29{29}, W30{30};
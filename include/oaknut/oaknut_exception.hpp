@@ -4,6 +4,21 @@
 #pragma once
 
 #include <exception>
+#include <optional>
+
+// Exceptions are unavailable when the compiler has them disabled (e.g. -fno-exceptions),
+// or when OAKNUT_NO_EXCEPTIONS is defined. Errors are then always deferred (see ErrorMode).
+#if !defined(OAKNUT_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+#    define OAKNUT_NO_EXCEPTIONS
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#    define OAKNUT_COLD [[gnu::cold, gnu::noinline]]
+#elif defined(_MSC_VER)
+#    define OAKNUT_COLD __declspec(noinline)
+#else
+#    define OAKNUT_COLD
+#endif
 
 namespace oaknut {
 
@@ -41,4 +56,70 @@ private:
     ExceptionType type;
 };
 
+/// How errors detected during emission are reported.
+/// Throw: an OaknutException is thrown at the point of error (default when exceptions are available).
+/// Defer: the first error is recorded and emission continues; check it with deferred_error().
+///        Instructions emitted with invalid operands have those operand fields truncated and must not be executed.
+/// The mode and the deferred error are per-thread.
+enum class ErrorMode {
+    Throw,
+    Defer,
+};
+
+namespace detail {
+
+struct ErrorState {
+#if defined(OAKNUT_NO_EXCEPTIONS)
+    ErrorMode mode = ErrorMode::Defer;
+#else
+    ErrorMode mode = ErrorMode::Throw;
+#endif
+    std::optional<ExceptionType> error;
+};
+
+inline ErrorState& error_state()
+{
+    thread_local ErrorState state;
+    return state;
+}
+
+OAKNUT_COLD inline void report_error(ExceptionType et)
+{
+    ErrorState& state = error_state();
+#if !defined(OAKNUT_NO_EXCEPTIONS)
+    if (state.mode == ErrorMode::Throw)
+        throw OaknutException{et};
+#endif
+    if (!state.error)
+        state.error = et;
+}
+
+}  // namespace detail
+
+inline ErrorMode get_error_mode()
+{
+    return detail::error_state().mode;
+}
+
+/// Without exception support only ErrorMode::Defer is available, and this has no effect.
+inline void set_error_mode(ErrorMode mode)
+{
+#if !defined(OAKNUT_NO_EXCEPTIONS)
+    detail::error_state().mode = mode;
+#else
+    (void)mode;
+#endif
+}
+
+/// The first error reported on this thread since the last clear_deferred_error(), if any.
+inline std::optional<ExceptionType> deferred_error()
+{
+    return detail::error_state().error;
+}
+
+inline void clear_deferred_error()
+{
+    detail::error_state().error = std::nullopt;
+}
+
 }  // namespace oaknut
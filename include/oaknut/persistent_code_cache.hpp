@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "oaknut/feature_detection/cpu_feature.hpp"
+#include "oaknut/impl/relocation.hpp"
+
+namespace oaknut {
+
+namespace detail {
+
+// File layout, in native byte order. Every part is aligned to 16 bytes from the start of the file:
+//
+//     PersistentHeader
+//     PersistentEntry[entry_count]                  (sorted by key)
+//     code and PersistentRelocation[] of each entry
+inline constexpr std::array<char, 8> persistent_magic{'O', 'A', 'K', 'N', 'U', 'T', 'C', 'C'};
+inline constexpr std::uint32_t persistent_version = 1;
+inline constexpr std::size_t persistent_feature_words = (cpu_feature_count + 63) / 64;
+
+struct PersistentHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t feature_count;  // cpu_feature_count of the writer
+    std::uint64_t entry_count;
+    std::uint64_t reserved;
+};
+
+struct PersistentEntry {
+    std::uint64_t key;
+    std::array<std::uint64_t, persistent_feature_words> features;
+    std::uint64_t code_offset;
+    std::uint64_t code_size;  // in bytes
+    std::uint64_t relocation_offset;
+    std::uint64_t relocation_count;
+};
+
+struct PersistentRelocation {
+    std::int64_t offset;
+    std::uint64_t target;
+    std::uint8_t kind;
+    std::uint8_t internal;
+    std::array<std::uint8_t, 6> reserved;
+};
+
+inline std::array<std::uint64_t, persistent_feature_words> feature_words(const CpuFeatures& features)
+{
+    std::array<std::uint64_t, persistent_feature_words> words{};
+    for (std::size_t i = 0; i < cpu_feature_count; i++) {
+        if (features.has(static_cast<CpuFeature>(i)))
+            words[i / 64] |= std::uint64_t{1} << (i % 64);
+    }
+    return words;
+}
+
+inline std::size_t align16(std::size_t size)
+{
+    return (size + 15) & ~std::size_t{15};
+}
+
+// Whether [offset, offset + count * element_size) lies within size bytes.
+inline bool in_bounds(std::uint64_t offset, std::uint64_t count, std::size_t element_size, std::size_t size)
+{
+    return offset <= size && count <= (size - offset) / element_size;
+}
+
+}  // namespace detail
+
+// Builds a persistent code cache file: code with its relocations (recorded with set_relocation_recording(true)),
+// keyed by a caller-provided hash and the CPU features it was compiled for.
+//
+// Absolute targets of relocations are stored relative to host_base, for example the address of a function in the
+// host executable, so that they follow the executable when a later process loads it at a different address. Code to
+// be persisted must only refer to addresses that are fixed relative to host_base, and only through relocations.
+class PersistentCodeCacheWriter {
+public:
+    explicit PersistentCodeCacheWriter(std::uintptr_t host_base = 0)
+        : m_host_base(host_base)
+    {}
+
+    void add(std::uint64_t key, const CpuFeatures& features, std::span<const std::uint32_t> code, std::span<const Relocation> relocations)
+    {
+        m_entries.push_back(Entry{key, detail::feature_words(features), {code.begin(), code.end()}, {relocations.begin(), relocations.end()}});
+    }
+
+    std::vector<std::byte> serialize() const
+    {
+        std::vector<const Entry*> entries;
+        for (const Entry& entry : m_entries)
+            entries.push_back(&entry);
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry* a, const Entry* b) { return a->key < b->key; });
+
+        std::size_t size = detail::align16(sizeof(detail::PersistentHeader)) + detail::align16(entries.size() * sizeof(detail::PersistentEntry));
+        std::vector<detail::PersistentEntry> table;
+        for (const Entry* entry : entries) {
+            detail::PersistentEntry stored{entry->key, entry->features, size, entry->code.size() * sizeof(std::uint32_t), 0, entry->relocations.size()};
+            size = detail::align16(size + stored.code_size);
+            stored.relocation_offset = size;
+            size = detail::align16(size + stored.relocation_count * sizeof(detail::PersistentRelocation));
+            table.push_back(stored);
+        }
+
+        std::vector<std::byte> data(size);
+        const detail::PersistentHeader header{detail::persistent_magic, detail::persistent_version, static_cast<std::uint32_t>(cpu_feature_count), entries.size(), 0};
+        std::memcpy(data.data(), &header, sizeof(header));
+        if (!table.empty())
+            std::memcpy(data.data() + detail::align16(sizeof(header)), table.data(), table.size() * sizeof(detail::PersistentEntry));
+
+        for (std::size_t i = 0; i < entries.size(); i++) {
+            if (!entries[i]->code.empty())
+                std::memcpy(data.data() + table[i].code_offset, entries[i]->code.data(), table[i].code_size);
+            std::byte* out = data.data() + table[i].relocation_offset;
+            for (const Relocation& relocation : entries[i]->relocations) {
+                const std::uint64_t target = relocation.internal ? relocation.target : relocation.target - m_host_base;
+                const detail::PersistentRelocation stored{relocation.offset, target, static_cast<std::uint8_t>(relocation.kind), relocation.internal, {}};
+                std::memcpy(out, &stored, sizeof(stored));
+                out += sizeof(stored);
+            }
+        }
+        return data;
+    }
+
+    // Returns false if the file could not be written.
+    bool write(const char* path) const
+    {
+        const std::vector<std::byte> data = serialize();
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file)
+            return false;
+        const bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+        return std::fclose(file) == 0 && written;
+    }
+
+private:
+    struct Entry {
+        std::uint64_t key;
+        std::array<std::uint64_t, detail::persistent_feature_words> features;
+        std::vector<std::uint32_t> code;
+        std::vector<Relocation> relocations;
+    };
+
+    std::uintptr_t m_host_base;
+    std::vector<Entry> m_entries;
+};
+
+// Code loaded from a PersistentCodeCache.
+struct PersistentCode {
+    std::span<const std::byte> code;
+    std::vector<Relocation> relocations;
+
+    std::size_t size() const
+    {
+        return code.size();
+    }
+
+    // Copies the code to wptr, relocated to run at xptr. The caller must invalidate the instruction cache for the
+    // code afterwards.
+    void load(std::uint32_t* wptr, std::uint32_t* xptr) const
+    {
+        if (!code.empty())
+            std::memcpy(wptr, code.data(), code.size());
+        relocate(std::span{wptr, code.size() / sizeof(std::uint32_t)}, relocations, reinterpret_cast<std::uintptr_t>(xptr));
+    }
+};
+
+// Reads a file written by PersistentCodeCacheWriter, mapping it into memory rather than reading it. host_base is
+// the current address of what host_base referred to when the file was written.
+// A file that is not valid (missing, truncated, or written by an incompatible version of oaknut) has no entries.
+// Entries are only found for the exact CPU features they were compiled for, and malformed entries are never found.
+class PersistentCodeCache {
+public:
+    explicit PersistentCodeCache(const char* path, std::uintptr_t host_base = 0)
+        : m_host_base(host_base)
+    {
+        map(path);
+        validate();
+    }
+
+    // data must outlive the cache.
+    explicit PersistentCodeCache(std::span<const std::byte> data, std::uintptr_t host_base = 0)
+        : m_data(data), m_host_base(host_base)
+    {
+        validate();
+    }
+
+    ~PersistentCodeCache()
+    {
+        unmap();
+    }
+
+    PersistentCodeCache(const PersistentCodeCache&) = delete;
+    PersistentCodeCache& operator=(const PersistentCodeCache&) = delete;
+
+    bool valid() const
+    {
+        return m_valid;
+    }
+
+    std::size_t size() const
+    {
+        return m_entry_count;
+    }
+
+    std::optional<PersistentCode> find(std::uint64_t key, const CpuFeatures& features) const
+    {
+        const auto words = detail::feature_words(features);
+
+        std::size_t first = 0, count = m_entry_count;
+        while (count > 0) {
+            const std::size_t half = count / 2;
+            if (entry(first + half).key < key) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+
+        for (std::size_t i = first; i < m_entry_count; i++) {
+            const detail::PersistentEntry stored = entry(i);
+            if (stored.key != key)
+                break;
+            if (stored.features == words)
+                return load_entry(stored);
+        }
+        return std::nullopt;
+    }
+
+private:
+    detail::PersistentEntry entry(std::size_t index) const
+    {
+        detail::PersistentEntry stored;
+        std::memcpy(&stored, m_data.data() + detail::align16(sizeof(detail::PersistentHeader)) + index * sizeof(stored), sizeof(stored));
+        return stored;
+    }
+
+    std::optional<PersistentCode> load_entry(const detail::PersistentEntry& stored) const
+    {
+        if (!detail::in_bounds(stored.code_offset, stored.code_size, 1, m_data.size()) || stored.code_size % sizeof(std::uint32_t) != 0)
+            return std::nullopt;
+        if (!detail::in_bounds(stored.relocation_offset, stored.relocation_count, sizeof(detail::PersistentRelocation), m_data.size()))
+            return std::nullopt;
+
+        PersistentCode code{m_data.subspan(stored.code_offset, stored.code_size), {}};
+        code.relocations.reserve(stored.relocation_count);
+        for (std::size_t i = 0; i < stored.relocation_count; i++) {
+            detail::PersistentRelocation relocation;
+            std::memcpy(&relocation, m_data.data() + stored.relocation_offset + i * sizeof(relocation), sizeof(relocation));
+
+            if (relocation.kind > static_cast<std::uint8_t>(RelocationKind::MovAbs64) || relocation.internal > 1)
+                return std::nullopt;
+            const auto kind = static_cast<RelocationKind>(relocation.kind);
+            const std::uint64_t field_size = kind == RelocationKind::MovAbs64 ? 16 : kind == RelocationKind::Abs64 ? 8 : 4;
+            if (relocation.offset < 0 || relocation.offset % 4 != 0 || static_cast<std::uint64_t>(relocation.offset) + field_size > stored.code_size)
+                return std::nullopt;
+
+            const bool internal = relocation.internal != 0;
+            const std::uint64_t target = internal ? relocation.target : relocation.target + m_host_base;
+            code.relocations.push_back(Relocation{static_cast<std::ptrdiff_t>(relocation.offset), kind, internal, target});
+        }
+        return code;
+    }
+
+    void validate()
+    {
+        detail::PersistentHeader header;
+        if (m_data.size() < sizeof(header))
+            return;
+        std::memcpy(&header, m_data.data(), sizeof(header));
+        if (header.magic != detail::persistent_magic || header.version != detail::persistent_version || header.feature_count != cpu_feature_count)
+            return;
+        if (!detail::in_bounds(detail::align16(sizeof(header)), header.entry_count, sizeof(detail::PersistentEntry), m_data.size()))
+            return;
+        m_entry_count = header.entry_count;
+        m_valid = true;
+    }
+
+    void map(const char* path)
+    {
+#if defined(_WIN32)
+        const HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            if (const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr)) {
+                if (void* memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+                    m_data = std::span{static_cast<const std::byte*>(memory), static_cast<std::size_t>(size.QuadPart)};
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#else
+        const int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* memory = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (memory != MAP_FAILED)
+                m_data = std::span{static_cast<const std::byte*>(memory), static_cast<std::size_t>(info.st_size)};
+        }
+        close(fd);
+#endif
+        m_mapped = !m_data.empty();
+    }
+
+    void unmap()
+    {
+        if (!m_mapped)
+            return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_data.data());
+#else
+        munmap(const_cast<std::byte*>(m_data.data()), m_data.size());
+#endif
+    }
+
+    std::span<const std::byte> m_data;
+    std::uintptr_t m_host_base;
+    bool m_mapped = false;
+    bool m_valid = false;
+    std::size_t m_entry_count = 0;
+};
+
+}  // namespace oaknut
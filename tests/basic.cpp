@@ -1,13 +1,22 @@
 // SPDX-FileCopyrightText: Copyright (c) 2022 merryhime <https://mary.rs>
 // SPDX-License-Identifier: MIT
 
+#include <atomic>
+#include <bit>
 #include <cstdint>
 #include <cstdio>
 #include <limits>
+#include <memory_resource>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "architecture.hpp"
+#include "oaknut/impl/cache_maintenance.hpp"
+#include "oaknut/impl/code_block_options.hpp"
 #include "oaknut/oaknut.hpp"
 #include "rand_int.hpp"
 
@@ -317,6 +326,156 @@ TEST_CASE("MOVP2R (4GiB boundary)")
     }
 }
 
+TEST_CASE("CodeBlock options")
+{
+    for (const HugePages huge_pages : {HugePages::None, HugePages::Transparent, HugePages::Explicit}) {
+        const CodeBlockOptions options{huge_pages, true};
+
+        CodeBlock mem{100, options};
+        REQUIRE(mem.size() % detail::page_size() == 0);
+#if defined(__linux__)
+        if (huge_pages != HugePages::None)
+            REQUIRE(mem.size() % detail::huge_page_size() == 0);
+#else
+        REQUIRE(mem.size() == detail::page_size());  // huge pages are ignored
+#endif
+
+        DualCodeBlock dual{100, options};
+        REQUIRE(dual.size() == mem.size());
+
+        CodeGenerator code{dual.wptr(), dual.xptr()};
+        code.MOV(W0, 42);
+        code.RET();
+        dual.invalidate_all();
+        REQUIRE(reinterpret_cast<int (*)()>(dual.xptr())() == 42);
+    }
+}
+
+namespace {
+
+int near_host_function(int x)
+{
+    return x * 2;
+}
+
+}  // namespace
+
+TEST_CASE("CodeBlock options (near placement)")
+{
+    CodeBlock mem{4096, {.near = reinterpret_cast<const void*>(&near_host_function)}};
+    CodeGenerator code{mem.ptr()};
+
+    mem.unprotect();
+    auto f = code.xptr<int (*)(int)>();
+    code.B(reinterpret_cast<const void*>(&near_host_function));  // a single direct branch
+    mem.protect();
+    mem.invalidate_all();
+
+    REQUIRE(f(21) == 42);
+}
+
+TEST_CASE("Patching")
+{
+    CodeBlock mem{4096};
+    CodeGenerator code{mem.ptr()};
+
+    mem.unprotect();
+
+    static_assert(is_cmodx_safe(0x1400'0000) && is_cmodx_safe(0x97ff'ffff));  // B, BL
+    static_assert(is_cmodx_safe(nop_instruction) && is_cmodx_safe(0xd503'3fdf));  // NOP, ISB
+    static_assert(is_cmodx_safe(0xd420'0000) && is_cmodx_safe(0xd400'0001));  // BRK, SVC
+    static_assert(!is_cmodx_safe(0x5280'0020) && !is_cmodx_safe(0x5400'0000) && !is_cmodx_safe(0xd400'0000));  // MOV, B.cond
+
+    auto f = code.xptr<int (*)()>();
+    std::uint32_t* const site = code.xptr<std::uint32_t*>();
+    code.NOP();
+    code.MOV(W0, 1);
+    code.RET();
+    std::uint32_t* const target = code.xptr<std::uint32_t*>();
+    code.MOV(W0, 2);
+    code.RET();
+
+    mem.protect();
+    mem.invalidate_all();
+    REQUIRE(f() == 1);
+
+    mem.unprotect();
+    mem.patch(site, encode_b(site, target));
+    mem.protect();
+    REQUIRE(f() == 2);
+
+    mem.unprotect();
+    const std::vector<PatchSite> sites{{site, nop_instruction}, {site + 1, nop_instruction}};
+    REQUIRE_THROWS_AS(mem.patch(sites), OaknutException);  // MOV is not safe to patch
+    mem.patch(std::span{sites}.first(1));
+    mem.protect();
+    REQUIRE(f() == 1);
+}
+
+TEST_CASE("Patching (Dual)")
+{
+    DualCodeBlock mem{4096};
+    CodeGenerator code{mem.wptr(), mem.xptr()};
+
+    auto f = code.xptr<int (*)()>();
+    std::uint32_t* const site = code.xptr<std::uint32_t*>();
+    code.NOP();
+    code.MOV(W0, 1);
+    code.RET();
+    std::uint32_t* const target = code.xptr<std::uint32_t*>();
+    code.MOV(W0, 2);
+    code.RET();
+
+    mem.invalidate_all();
+    REQUIRE(f() == 1);
+
+    mem.patch(std::vector<PatchSite>{{site, encode_b(site, target)}});
+    REQUIRE(f() == 2);
+}
+
+TEST_CASE("Dirty range tracking (execution)")
+{
+    DualCodeBlock mem{65536};
+    CodeGenerator code{mem.wptr(), mem.xptr()};
+    code.set_dirty_tracking(true);
+
+    auto f = code.xptr<int (*)()>();
+    code.MOV(W0, 1);
+    code.RET();
+    code.set_offset(40000);
+    auto g = code.xptr<int (*)()>();
+    code.MOV(W0, 2);
+    code.RET();
+
+    mem.invalidate(code.dirty_ranges());
+    code.clear_dirty_ranges();
+    REQUIRE(f() == 1);
+    REQUIRE(g() == 2);
+}
+
+TEST_CASE("Publishing to other threads")
+{
+    DualCodeBlock mem{4096};
+    CodeGenerator code{mem.wptr(), mem.xptr()};
+
+    auto f = code.xptr<int (*)()>();
+    code.MOV(W0, 42);
+    code.RET();
+
+    std::atomic<bool> published = false;
+    int result = 0;
+    std::thread worker{[&] {
+        while (!published.load(std::memory_order_acquire)) {}
+        result = f();
+    }};
+
+    if (!mem.publish(mem.xptr(), code.offset()))
+        WARN("membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE) is unavailable");
+    published.store(true, std::memory_order_release);
+    worker.join();
+    REQUIRE(result == 42);
+}
+
 #endif
 
 TEST_CASE("PageOffset (rollover)")
@@ -331,3 +490,792 @@ TEST_CASE("PageOffset (page boundary)")
     REQUIRE(PageOffset<21, 12>::encode(0x0001000000001000, 0x0001000000000fff) == 0x1fffff);
     REQUIRE(PageOffset<21, 12>::encode(0x0001000000000fff, 0x0001000000001000) == 0x080000);
 }
+
+TEST_CASE("Label (many forward references)")
+{
+    std::uint32_t mem[64];
+    CodeGenerator code{mem};
+
+    Label target;
+    for (int i = 0; i < 8; i++) {
+        code.B(target);
+    }
+    code.CBZ(X0, target);
+    code.B(EQ, target);
+    code.TBNZ(W1, 3, target);
+    code.ADR(X2, target);
+    code.NOP();
+    code.l(target);
+    code.RET();
+
+    for (std::uint32_t i = 0; i < 8; i++) {
+        REQUIRE(mem[i] == (0x14000000 | (13 - i)));
+    }
+    REQUIRE(mem[8] == (0xb4000000 | (5 << 5)));
+    REQUIRE(mem[9] == (0x54000000 | (4 << 5)));
+    REQUIRE(mem[10] == (0x37180001 | (3 << 5)));
+    REQUIRE(mem[11] == (0x10000002 | (2 << 5)));
+}
+
+TEST_CASE("Label (reuse across many short-lived labels)")
+{
+    std::uint32_t mem[3 * 100];
+    CodeGenerator code{mem};
+
+    for (int i = 0; i < 100; i++) {
+        Label skip;
+        code.CBNZ(W0, skip);
+        code.B(skip);
+        code.l(skip);
+        code.NOP();
+    }
+
+    for (int i = 0; i < 100; i++) {
+        REQUIRE(mem[i * 3 + 0] == (0x35000000 | (2 << 5)));
+        REQUIRE(mem[i * 3 + 1] == 0x14000001);
+    }
+}
+
+TEST_CASE("Label (moved while pending)")
+{
+    std::uint32_t mem[4];
+    CodeGenerator code{mem};
+
+    Label a;
+    code.B(a);
+    code.NOP();
+    Label b{std::move(a)};
+    REQUIRE(!b.is_bound());
+    code.l(b);
+    code.NOP();
+    code.B(b);
+
+    REQUIRE(mem[0] == 0x14000002);
+    REQUIRE(mem[3] == 0x17ffffff);
+}
+
+TEST_CASE("Label (copying)")
+{
+    std::uint32_t mem[4];
+    CodeGenerator code{mem};
+
+    Label bound = code.l();
+    Label copy{bound};
+    REQUIRE(copy.is_bound());
+    REQUIRE(copy.offset() == 0);
+
+    Label unused;
+    copy = unused;
+    REQUIRE(!copy.is_bound());
+
+    Label pending;
+    code.B(pending);
+    REQUIRE_THROWS_AS(Label{pending}, OaknutException);
+    REQUIRE_THROWS_AS(pending = bound, OaknutException);
+    REQUIRE_THROWS_AS(pending = Label{}, OaknutException);
+    code.l(pending);
+    REQUIRE(mem[0] == 0x14000001);
+}
+
+TEST_CASE("Deferred errors")
+{
+    std::uint32_t mem[8];
+    CodeGenerator code{mem};
+
+    REQUIRE_THROWS_AS(code.ADD(X0, X1, 0x1001), OaknutException);
+
+    set_error_mode(ErrorMode::Defer);
+    clear_deferred_error();
+
+    code.ADD(X0, X1, 0x1001);
+    code.LSL(W0, W1, 40);
+    REQUIRE(deferred_error() == ExceptionType::InvalidAddSubImm);
+
+    Label label;
+    code.l(label);
+    code.l(label);
+    REQUIRE(code.offset() == 8);
+    REQUIRE(deferred_error() == ExceptionType::InvalidAddSubImm);
+
+    clear_deferred_error();
+    code.ADD(X0, X1, 1);
+    REQUIRE(!deferred_error());
+    REQUIRE(mem[2] == 0x91000420);
+
+    set_error_mode(ErrorMode::Throw);
+}
+
+TEST_CASE("Branch relaxation (backward)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    Label head;
+    code.l(head);
+    for (int i = 0; i < 0x40001; i++)
+        code.NOP();
+
+    REQUIRE_THROWS_AS(code.B(EQ, head), OaknutException);
+    REQUIRE(code.offset() == 0x100004);
+
+    code.set_branch_relaxation(true);
+    code.B(EQ, head);
+    code.CBZ(X3, head);
+    code.TBZ(W3, 5, head);
+    code.B(AL, head);
+
+    Label near = code.l();
+    code.B(EQ, near);
+
+    REQUIRE(vec[0x40001] == 0x54000041);  // b.ne #8
+    REQUIRE(vec[0x40002] == 0x17fbfffe);
+    REQUIRE(vec[0x40003] == 0xb5000043);  // cbnz x3, #8
+    REQUIRE(vec[0x40004] == 0x17fbfffc);
+    REQUIRE(vec[0x40005] == 0x37280043);  // tbnz w3, #5, #8
+    REQUIRE(vec[0x40006] == 0x17fbfffa);
+    REQUIRE(vec[0x40007] == 0x17fbfff9);
+    REQUIRE(vec[0x40008] == 0x54000000);
+}
+
+TEST_CASE("Branch relaxation (forward)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+    code.set_branch_relaxation(true);
+
+    Label near;
+    code.TBZ(X0, 3, near);
+    for (int i = 0; i < 0x1000; i++)
+        code.NOP();
+    code.l(near);
+    for (int i = 0; i < 0x2000; i++)
+        code.NOP();
+    REQUIRE(code.offset() == 0xC004);
+    REQUIRE(vec[0] == 0x361a0020);
+
+    Label far;
+    code.TBZ(X0, 3, far);
+    code.B(NE, far);
+    for (int i = 0; i < 0x3000; i++)
+        code.NOP();
+    code.l(far);
+
+    const std::uint32_t tbz = vec[0x3001];
+    const std::ptrdiff_t veneer = 0xC004 + ((tbz >> 5) & 0x3FFF) * 4;
+    REQUIRE(veneer < 0xC004 + 0x8000);
+    REQUIRE(vec[veneer / 4 - 1] == 0x14000002);
+    REQUIRE(veneer + (vec[veneer / 4] & 0x3FFFFFF) * 4 == far.offset());
+
+    const std::uint32_t bne = vec[0x3002];
+    REQUIRE(0xC008 + ((bne >> 5) & 0x7FFFF) * 4 == far.offset());
+
+    REQUIRE(far.offset() == 0xC004 + 4 * (2 + 0x3000 + 2));
+}
+
+TEST_CASE("Branch relaxation (island at a relaxed branch)")
+{
+    // The island for the TBZ is due at 0x107FE4; the relaxed B.EQ is placed at each position around it.
+    for (std::ptrdiff_t start = 0x107FD8; start < 0x107FF0; start += 4) {
+        std::vector<std::uint32_t> vec;
+        VectorCodeGenerator code{vec};
+
+        Label head;
+        code.l(head);
+        for (int i = 0; i < 0x40001; i++)
+            code.NOP();
+
+        code.set_branch_relaxation(true);
+        Label later;
+        code.TBZ(X0, 3, later);
+        while (code.offset() < start)
+            code.NOP();
+        code.B(EQ, head);
+        code.l(later);
+
+        const std::size_t b = vec.size() - 1;
+        REQUIRE(vec[b - 1] == 0x54000041);  // b.ne #8
+        REQUIRE(static_cast<std::ptrdiff_t>(b * 4) + (static_cast<std::int32_t>(vec[b] << 6) >> 4) == head.offset());
+    }
+}
+
+TEST_CASE("Branch relaxation (data)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+    code.set_branch_relaxation(true);
+
+    Label target;
+    code.TBZ(X0, 3, target);
+    for (int i = 0; i < 0x1000; i++)
+        code.dw(0);
+    for (int i = 0; i < 0x1000; i++)
+        code.dx(0);
+    code.l(target);
+
+    const std::ptrdiff_t veneer = ((vec[0] >> 5) & 0x3FFF) * 4;
+    REQUIRE((vec[veneer / 4] & 0xFC000000) == 0x14000000);
+    REQUIRE(veneer + (vec[veneer / 4] & 0x3FFFFFF) * 4 == target.offset());
+    REQUIRE(target.offset() > 0x8000);
+}
+
+TEST_CASE("Literal pool")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    code.LDR(X0, code.literal64(0x123456789abcdef0));
+    code.LDR(X1, code.literal64(0x123456789abcdef0));
+    code.LDR(Q2, code.literal128(1, 2));
+    code.RET();
+    code.flush_literals();
+
+    REQUIRE(vec.size() == 10);
+    REQUIRE(vec[0] == 0x58000100);
+    REQUIRE(vec[1] == 0x580000e1);
+    REQUIRE(vec[2] == 0x9c000042);
+    REQUIRE(vec[3] == 0xd65f03c0);
+    REQUIRE(vec[4] == 1);
+    REQUIRE(vec[5] == 0);
+    REQUIRE(vec[6] == 2);
+    REQUIRE(vec[7] == 0);
+    REQUIRE(vec[8] == 0x9abcdef0);
+    REQUIRE(vec[9] == 0x12345678);
+
+    code.LDR(X3, code.literal64(0x123456789abcdef0));
+    code.flush_literals();
+
+    REQUIRE(vec.size() == 14);
+    REQUIRE(vec[10] == 0x58000043);
+    REQUIRE(vec[12] == 0x9abcdef0);
+}
+
+TEST_CASE("Literal pool (automatic flush)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    code.LDR(X0, code.literal64(42));
+    for (int i = 0; i < 0x40000; i++)
+        code.NOP();
+
+    const std::size_t target = ((vec[0] >> 5) & 0x7FFFF);
+    REQUIRE(target < vec.size());
+    REQUIRE(vec[target] == 42);
+    REQUIRE(vec[target + 1] == 0);
+
+    const std::size_t skip = target - 1 - (vec[target - 1] == 0 ? 1 : 0);
+    REQUIRE((vec[skip] & 0xFC000000) == 0x14000000);
+    REQUIRE(skip + (vec[skip] & 0x3FFFFFF) == target + 2);
+    REQUIRE(vec.size() == 0x40001 + (target + 2 - skip));
+}
+
+TEST_CASE("Literal pool (pending literals)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    REQUIRE(!code.has_pending_literals());
+    code.finalize();
+
+    code.LDR(X0, code.literal64(42));
+    code.RET();
+    REQUIRE(code.has_pending_literals());
+    REQUIRE_THROWS_AS(code.finalize(), OaknutException);
+
+    code.flush_literals();
+    REQUIRE(!code.has_pending_literals());
+    code.finalize();
+    REQUIRE(vec[0] == 0x58000040);
+}
+
+namespace {
+
+// Evaluates a sequence of MOVZ, MOVN, MOVK, ORR (immediate) and ORR (shifted register, Rd == Rn == Rm) instructions.
+std::uint64_t evaluate_mov_sequence(const std::vector<std::uint32_t>& code)
+{
+    const auto decode_bit_imm = [](std::uint32_t n, std::uint32_t immr, std::uint32_t imms) {
+        const int len = std::bit_width((n << 6) | (~imms & 0x3F)) - 1;
+        const unsigned esize = 1u << len;
+        const unsigned s = imms & (esize - 1), r = immr & (esize - 1);
+        const std::uint64_t emask = esize == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << esize) - 1;
+        const std::uint64_t welem = (std::uint64_t{1} << (s + 1)) - 1;
+        std::uint64_t elem = r == 0 ? welem : ((welem >> r) | (welem << (esize - r))) & emask;
+        for (unsigned i = esize; i < 64; i *= 2)
+            elem |= elem << i;
+        return elem;
+    };
+
+    std::uint64_t x = 0;
+    for (const std::uint32_t inst : code) {
+        const bool sf = inst >> 31;
+        const std::uint64_t width_mask = sf ? ~std::uint64_t{0} : 0xFFFF'FFFF;
+        const unsigned hw = (inst >> 21) & 3;
+        const std::uint64_t imm16 = (inst >> 5) & 0xFFFF;
+        switch ((inst >> 23) & 0xFF) {
+        case 0xA5:  // MOVZ
+            x = (imm16 << (16 * hw)) & width_mask;
+            break;
+        case 0x25:  // MOVN
+            x = ~(imm16 << (16 * hw)) & width_mask;
+            break;
+        case 0xE5:  // MOVK
+            x = ((x & ~(std::uint64_t{0xFFFF} << (16 * hw))) | (imm16 << (16 * hw))) & width_mask;
+            break;
+        case 0x64:  // ORR (immediate), Rn == ZR
+            x = decode_bit_imm((inst >> 22) & 1, (inst >> 16) & 0x3F, (inst >> 10) & 0x3F) & width_mask;
+            break;
+        default:
+            REQUIRE((inst & 0xFFE0FC00) == 0xAA008000);  // ORR (shifted register), LSL #32
+            x |= x << 32;
+            break;
+        }
+    }
+    return x;
+}
+
+}  // namespace
+
+TEST_CASE("MOV (64-bit immediate)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    const auto check = [&](std::uint64_t value) {
+        vec.clear();
+        code.MOV(X0, value);
+        INFO(value);
+        REQUIRE(evaluate_mov_sequence(vec) == value);
+        REQUIRE(static_cast<int>(vec.size()) == materialize_cost(value));
+    };
+
+    for (int i = 0; i < 0x10000; i++) {
+        const std::uint64_t r = RandInt<std::uint64_t>(0, 0xffffffff'ffffffff);
+        const std::uint64_t halfwords[4] = {0, 0xFFFF, r & 0xFFFF, (r >> 16) & 0xFFFF};
+        std::uint64_t value = 0;
+        for (int j = 0; j < 4; j++)
+            value |= halfwords[RandInt<int>(0, 3)] << (16 * j);
+        check(value);
+        check(r);
+        check(0x00FF'00FF'00FF'00FF << (r & 63));
+    }
+
+    check(0);
+    check(~std::uint64_t{0});
+    check(0x8000'0000'0000'0000);
+
+    REQUIRE(materialize_cost(0xFFFF'1234'FFFF'5678) == 2);  // MOVN, MOVK
+    REQUIRE(materialize_cost(0x00FF'00FF'1234'00FF) == 2);  // ORR, MOVK
+    REQUIRE(materialize_cost(0x1234'5678'1234'5678) == 3);  // MOVZ, MOVK, ORR LSL #32
+    REQUIRE(materialize_cost(0x0000'0000'FFFF'1234) == 1);  // MOVN (32-bit)
+    REQUIRE(materialize_cost(0x1234'5678'9ABC'DEF0) == 4);
+}
+
+namespace {
+
+// Evaluates a sequence of MOVI, MVNI, ORR, BIC, FMOV (immediate) and LDR (literal) instructions writing one
+// vector register, stopping at the first word that is none of these. Returns the low and high doublewords.
+std::pair<std::uint64_t, std::uint64_t> evaluate_vector_mov_sequence(const std::vector<std::uint32_t>& code)
+{
+    const auto replicate = [](std::uint64_t element, int esize) {
+        for (int i = esize; i < 64; i *= 2)
+            element |= element << i;
+        return element;
+    };
+    const auto expand_fp32 = [](std::uint32_t imm8) {
+        const std::uint32_t b = (imm8 >> 6) & 1;
+        return ((imm8 & 0x80) << 24) | ((b ^ 1) << 30) | ((b * 0x1F) << 25) | ((imm8 & 0x3F) << 19);
+    };
+    const auto expand_fp64 = [](std::uint64_t imm8) {
+        const std::uint64_t b = (imm8 >> 6) & 1;
+        return ((imm8 & 0x80) << 56) | ((b ^ 1) << 62) | ((b * 0xFF) << 54) | ((imm8 & 0x3F) << 48);
+    };
+
+    std::uint64_t lo = 0, hi = 0;
+    for (std::size_t i = 0; i < code.size(); i++) {
+        const std::uint32_t inst = code[i];
+        if ((inst & 0x9FF80C00) == 0x0F000400) {
+            const bool q = (inst >> 30) & 1, op = (inst >> 29) & 1;
+            const std::uint32_t cmode = (inst >> 12) & 0xF;
+            const std::uint64_t imm8 = ((inst >> 11) & 0xE0) | ((inst >> 5) & 0x1F);
+
+            std::uint64_t imm = 0;
+            switch (cmode >> 1) {
+            case 0b000:
+            case 0b001:
+            case 0b010:
+            case 0b011:
+                imm = replicate(imm8 << (8 * (cmode >> 1)), 32);
+                break;
+            case 0b100:
+            case 0b101:
+                imm = replicate(imm8 << (8 * ((cmode >> 1) & 1)), 16);
+                break;
+            case 0b110:
+                imm = replicate(cmode & 1 ? (imm8 << 16) | 0xFFFF : (imm8 << 8) | 0xFF, 32);
+                break;
+            case 0b111:
+                if ((cmode & 1) == 0 && !op) {
+                    imm = replicate(imm8, 8);
+                } else if ((cmode & 1) == 0) {
+                    for (int j = 0; j < 8; j++)
+                        imm |= ((imm8 >> j) & 1) * (std::uint64_t{0xFF} << (8 * j));
+                } else {
+                    imm = op ? expand_fp64(imm8) : replicate(expand_fp32(static_cast<std::uint32_t>(imm8)), 32);
+                }
+                break;
+            }
+
+            const std::uint64_t hi_mask = q ? ~std::uint64_t{0} : 0;
+            if ((cmode & 1) && cmode < 0b1100) {
+                lo = op ? lo & ~imm : lo | imm;
+                hi = (op ? hi & ~imm : hi | imm) & hi_mask;
+            } else {
+                imm = op && cmode < 0b1110 ? ~imm : imm;
+                lo = imm;
+                hi = imm & hi_mask;
+            }
+        } else if ((inst & 0xFFA01FE0) == 0x1E201000) {
+            const std::uint32_t imm8 = (inst >> 13) & 0xFF;
+            lo = (inst >> 22) & 1 ? expand_fp64(imm8) : expand_fp32(imm8);
+            hi = 0;
+        } else if ((inst & 0x3F000000) == 0x1C000000) {
+            const std::size_t target = i + (((inst >> 5) & 0x7FFFF) ^ 0x40000) - 0x40000;
+            const std::uint64_t data_lo = code[target] | (std::uint64_t{code[target + 1]} << 32);
+            switch (inst >> 30) {
+            case 0:
+                lo = static_cast<std::uint32_t>(data_lo);
+                hi = 0;
+                break;
+            case 1:
+                lo = data_lo;
+                hi = 0;
+                break;
+            case 2:
+                lo = data_lo;
+                hi = code[target + 2] | (std::uint64_t{code[target + 3]} << 32);
+                break;
+            }
+        } else {
+            break;
+        }
+    }
+    return {lo, hi};
+}
+
+}  // namespace
+
+TEST_CASE("MOV (vector immediate)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    const auto instruction_count = [&] {
+        const bool literal = !vec.empty() && (vec.back() & 0x3F000000) == 0x1C000000;
+        code.flush_literals();
+        return literal ? -1 : static_cast<int>(vec.size());
+    };
+    const auto check = [&](std::uint64_t lo, std::uint64_t hi) {
+        INFO(lo << " " << hi);
+        vec.clear();
+        code.MOV(Q0, lo, hi);
+        const int count = instruction_count();
+        REQUIRE(evaluate_vector_mov_sequence(vec) == std::pair{lo, hi});
+        REQUIRE(count <= 2);
+
+        vec.clear();
+        code.MOV(D1, lo);
+        instruction_count();
+        REQUIRE(evaluate_vector_mov_sequence(vec) == std::pair{lo, std::uint64_t{0}});
+        return count;
+    };
+
+    for (int i = 0; i < 0x4000; i++) {
+        const std::uint64_t r = RandInt<std::uint64_t>(0, 0xffffffff'ffffffff);
+        const std::uint64_t bytes[4] = {0, 0xFF, r & 0xFF, (r >> 8) & 0xFF};
+        std::uint64_t word = 0;
+        for (int j = 0; j < 4; j++)
+            word |= bytes[RandInt<int>(0, 3)] << (8 * j);
+        check(word * 0x0000'0001'0000'0001, word * 0x0000'0001'0000'0001);
+        check((word & 0xFFFF) * 0x0001'0001'0001'0001, 0);
+        check(r, r);
+        check(r, 0);
+        check(r, ~r);
+    }
+
+    REQUIRE(check(0, 0) == 1);                                          // MOVI (64-bit)
+    REQUIRE(check(0xFF00'FF00'0000'FFFF, 0xFF00'FF00'0000'FFFF) == 1);  // MOVI (64-bit)
+    REQUIRE(check(0x1200'0000'1200'0000, 0x1200'0000'1200'0000) == 1);  // MOVI (32-bit, LSL #24)
+    REQUIRE(check(0xFFFF'EDFF'FFFF'EDFF, 0) == 1);                      // MVNI (32-bit, LSL #8)
+    REQUIRE(check(0x0012'FFFF'0012'FFFF, 0) == 1);                      // MOVI (32-bit, MSL #16)
+    REQUIRE(check(0x3F80'0000'3F80'0000, 0) == 1);                      // FMOV (single-precision)
+    REQUIRE(check(0x4024'0000'0000'0000, 0) == 1);                      // FMOV (double-precision)
+    REQUIRE(check(0x1234'1234'1234'1234, 0) == 2);                      // MOVI, ORR (16-bit)
+    REQUIRE(check(0x0012'0034'0012'0034, 0) == 2);                      // MOVI, ORR (32-bit)
+    REQUIRE(check(0xFF12'FF34'FF12'FF34, 0) == 2);                      // MVNI, BIC (32-bit)
+    REQUIRE(check(0x1234'5678'1234'5678, 0) == -1);
+    REQUIRE(check(0x0000'0000'0000'0001, 1) == -1);
+
+    vec.clear();
+    code.FMOV(S2, 1.0f);
+    code.FMOV(D3, -10.0);
+    REQUIRE(vec == std::vector<std::uint32_t>{0x1e2e1002, 0x1e749003});
+
+    for (const float value : {0.0f, 0.1f, -1.5e10f, std::numeric_limits<float>::infinity()}) {
+        vec.clear();
+        code.FMOV(S2, value);
+        code.flush_literals();
+        REQUIRE(static_cast<std::uint32_t>(evaluate_vector_mov_sequence(vec).first) == std::bit_cast<std::uint32_t>(value));
+    }
+    for (const double value : {0.0, 0.1, -1.5e100, std::numeric_limits<double>::infinity()}) {
+        vec.clear();
+        code.FMOV(D3, value);
+        code.flush_literals();
+        REQUIRE(evaluate_vector_mov_sequence(vec) == std::pair{std::bit_cast<std::uint64_t>(value), std::uint64_t{0}});
+    }
+}
+
+TEST_CASE("MOV (vector immediate, scratch register)")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+
+    // Returns the value the words before the last count words move into the scratch register.
+    const auto scratch_value = [&](std::size_t count) {
+        return evaluate_mov_sequence({vec.begin(), vec.end() - count});
+    };
+
+    code.MOV(D0, 0x1234'5678'1234'5678, X9);
+    REQUIRE(vec.back() == 0x9e670120);  // FMOV D0, X9
+    REQUIRE(scratch_value(1) == 0x1234'5678'1234'5678);
+
+    vec.clear();
+    code.MOV(Q1, 0x1234'5678'9abc'def0, 0x1234'5678'9abc'def0, X9);
+    REQUIRE(vec.back() == 0x4e080d21);  // DUP V1.2D, X9
+    REQUIRE(scratch_value(1) == 0x1234'5678'9abc'def0);
+
+    vec.clear();
+    code.MOV(Q2, 0x1234'5678'9abc'def0, 1, X9);
+    REQUIRE(vec.size() == 7);
+    REQUIRE(vec[4] == 0x9e670122);  // FMOV D2, X9
+    REQUIRE(vec[5] == 0x52800029);  // MOV W9, #1
+    REQUIRE(vec[6] == 0x9eaf0122);  // FMOV V2.D[1], X9
+
+    vec.clear();
+    code.FMOV(S2, 0.1f, W9);
+    REQUIRE(vec.back() == 0x1e270122);  // FMOV S2, W9
+    REQUIRE(scratch_value(1) == std::bit_cast<std::uint32_t>(0.1f));
+
+    vec.clear();
+    code.FMOV(D3, 0.1, X9);
+    REQUIRE(vec.back() == 0x9e670123);  // FMOV D3, X9
+    REQUIRE(scratch_value(1) == std::bit_cast<std::uint64_t>(0.1));
+
+    vec.clear();
+    code.MOV(Q0, 0x3f800000'3f800000, 0x3f800000'3f800000, X9);
+    code.FMOV(D3, -10.0, X9);
+    REQUIRE(vec == std::vector<std::uint32_t>{0x4f03f600, 0x1e749003});
+    REQUIRE(!code.has_pending_literals());
+}
+
+namespace {
+
+template<typename CodeGen>
+void emit_segmented_workload(CodeGen& code)
+{
+    Label loop, done;
+    code.l(loop);
+    for (int i = 0; i < 100; i++) {
+        code.ADD(X0, X0, i);
+        code.CBZ(X0, done);
+        code.LDR(X1, code.literal64(i % 7));
+    }
+    code.B(loop);
+    code.flush_literals();
+    code.l(done);
+    code.RET();
+}
+
+}  // namespace
+
+TEST_CASE("SegmentedCodeGenerator")
+{
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator reference{vec};
+    emit_segmented_workload(reference);
+
+    SegmentedBuffer<> buffer{16};
+    REQUIRE(buffer.segment_words() == 16);
+
+    for (int round = 0; round < 2; round++) {
+        buffer.clear();
+        SegmentedCodeGenerator code{buffer};
+        emit_segmented_workload(code);
+
+        REQUIRE(code.offset() == reference.offset());
+        REQUIRE(buffer.size() == vec.size());
+        std::vector<std::uint32_t> flat(buffer.size());
+        buffer.copy_to(flat.data());
+        REQUIRE(flat == vec);
+    }
+}
+
+TEST_CASE("SegmentedCodeGenerator (std::pmr)")
+{
+    std::pmr::monotonic_buffer_resource resource;
+    SegmentedBuffer<std::pmr::polymorphic_allocator<std::uint32_t>> buffer{100, &resource};
+    REQUIRE(buffer.segment_words() == 128);
+
+    buffer.reserve(1000);
+    SegmentedCodeGenerator code{buffer};
+    for (int i = 0; i < 1000; i++)
+        code.NOP();
+
+    REQUIRE(buffer.size() == 1000);
+    REQUIRE(buffer[0] == 0xd503201f);
+    REQUIRE(buffer[999] == 0xd503201f);
+}
+
+TEST_CASE("BoundedCodeGenerator")
+{
+    std::vector<std::uint32_t> mem(128);
+
+    SECTION("Overflow without a handler")
+    {
+        BoundedCodeGenerator code{mem.data(), 4};
+        for (int i = 0; i < 4; i++)
+            code.NOP();
+        REQUIRE(code.remaining() == 0);
+        REQUIRE_THROWS_AS(code.NOP(), OaknutException);
+        REQUIRE(code.offset() == 16);
+    }
+
+    SECTION("Chaining")
+    {
+        int calls = 0;
+        BoundedCodeGenerator code{mem.data(), 8};
+        code.set_overflow_handler([&]() -> std::optional<CodeRegion> {
+            calls++;
+            return CodeRegion{mem.data() + 64, mem.data() + 64, 64};
+        });
+        REQUIRE(code.remaining() == 7);
+
+        Label start = code.l(), forward;
+        code.B(forward);
+        for (int i = 0; i < 10; i++)
+            code.NOP();
+        code.l(forward);
+        code.CBZ(X0, start);
+
+        REQUIRE(calls == 1);
+        REQUIRE(mem[0] == 0x14000000 + 64 + 4);  // B forward
+        REQUIRE(mem[7] == 0x14000000 + 64 - 7);  // B to the next region
+        REQUIRE(mem[64] == 0xd503201f);
+        REQUIRE(mem[68] == 0xb4000000 + ((-68 & 0x7FFFF) << 5));  // CBZ X0, start
+        REQUIRE(code.offset() == 4 * 69);
+        REQUIRE(code.xptr<std::uint32_t*>() == mem.data() + 69);
+    }
+
+    SECTION("Handler declines")
+    {
+        BoundedCodeGenerator code{mem.data(), 2};
+        code.set_overflow_handler([] { return std::optional<CodeRegion>{}; });
+        code.NOP();
+        REQUIRE_THROWS_AS(code.NOP(), OaknutException);
+    }
+}
+
+TEST_CASE("DirtyRanges")
+{
+    DirtyRanges ranges;
+    ranges.add(0x1000, 0x1100);
+    ranges.add(0x1100, 0x1200);  // merged with the previous range
+    ranges.add(0x3000, 0x3000);  // empty
+    ranges.add(0x2000, 0x2040);
+    ranges.add(0x1180, 0x1400);
+    ranges.add(0x1400, 0x1404);
+    REQUIRE(ranges.ranges().size() == 3);
+
+    ranges.normalize();
+    REQUIRE(std::vector(ranges.ranges().begin(), ranges.ranges().end()) == std::vector<DirtyRange>{{0x1000, 0x1404}, {0x2000, 0x2040}});
+}
+
+TEST_CASE("Dirty range tracking")
+{
+    std::vector<std::uint32_t> wmem(1024);
+    std::uint32_t* const xmem = reinterpret_cast<std::uint32_t*>(0x10000);
+    const auto x = [&](std::size_t index) { return reinterpret_cast<std::uintptr_t>(xmem + index); };
+
+    CodeGenerator code{wmem.data(), xmem};
+    code.NOP();  // not tracked
+    code.set_dirty_tracking(true);
+
+    Label forward;
+    code.B(forward);
+    code.NOP();
+    code.set_xptr(xmem + 512);
+    code.NOP();
+    code.set_xptr(xmem + 100);
+    code.l(forward);  // fixup of word 1
+    code.NOP();
+    code.NOP();
+    REQUIRE(std::vector(code.dirty_ranges().ranges().begin(), code.dirty_ranges().ranges().end()) == std::vector<DirtyRange>{{x(1), x(3)}, {x(100), x(102)}, {x(512), x(513)}});
+
+    code.clear_dirty_ranges();
+    REQUIRE(code.dirty_ranges().empty());
+    code.NOP();
+    REQUIRE(std::vector(code.dirty_ranges().ranges().begin(), code.dirty_ranges().ranges().end()) == std::vector<DirtyRange>{{x(102), x(103)}});
+
+    code.set_dirty_tracking(false);
+    code.NOP();
+    REQUIRE(code.dirty_ranges().ranges().size() == 1);
+}
+
+TEST_CASE("CTR_EL0 decoding")
+{
+    constexpr auto plain = detail::decode_ctr_el0(0x8444'c004);
+    static_assert(plain.icache_line == 64 && plain.dcache_line == 64 && !plain.idc && !plain.dic);
+
+    constexpr auto coherent = detail::decode_ctr_el0(0xb444'c004);
+    static_assert(coherent.idc && coherent.dic);
+
+    constexpr auto mixed = detail::decode_ctr_el0(0x9003'0003);
+    static_assert(mixed.icache_line == 32 && mixed.dcache_line == 32 && mixed.idc && !mixed.dic);
+    SUCCEED();
+}
+
+TEST_CASE("Near placement search")
+{
+    constexpr std::uintptr_t target = 0x5555'0000'0000;
+    constexpr std::size_t size = 0x40'0000;
+    const CodeBlockOptions options{.near = reinterpret_cast<const void*>(target), .near_distance = near_branch_range};
+
+    std::vector<std::uintptr_t> probes;
+    const auto first_free_above = [&](std::uintptr_t occupied_until) {
+        return detail::map_near(options, size, 0x1'0000, [&](void* hint) -> void* {
+            const auto addr = reinterpret_cast<std::uintptr_t>(hint);
+            probes.push_back(addr);
+            return addr >= occupied_until || addr + size <= target - 0x100'0000 ? hint : nullptr;
+        });
+    };
+
+    // Probes alternate above and below the target, closest first
+    REQUIRE(reinterpret_cast<std::uintptr_t>(first_free_above(target + 0x20'0000)) == target + 0x20'0000);
+    REQUIRE(probes == std::vector<std::uintptr_t>{target, target - size, target + 0x10'0000, target - size - 0x10'0000, target + 0x20'0000});
+
+    // Every probe keeps the whole block within range, and the search ends once the range is exhausted
+    probes.clear();
+    REQUIRE(first_free_above(~std::uintptr_t{0}) != nullptr);
+    probes.clear();
+    const CodeBlockOptions narrow{.near = reinterpret_cast<const void*>(target), .near_distance = 0x80'0000};
+    REQUIRE(detail::map_near(narrow, size, 0x1'0000, [&](void* hint) -> void* {
+                probes.push_back(reinterpret_cast<std::uintptr_t>(hint));
+                return nullptr;
+            }) == nullptr);
+    for (const std::uintptr_t probe : probes)
+        REQUIRE((probe + size <= target + 0x80'0000 && probe + 0x80'0000 >= target));
+    REQUIRE(probes.size() == 10);
+
+    const CodeBlockOptions too_small{.near = reinterpret_cast<const void*>(target), .near_distance = size - 1};
+    REQUIRE(detail::map_near(too_small, size, 0x1'0000, [](void* hint) { return hint; }) == nullptr);
+}
+
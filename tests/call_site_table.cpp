@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "architecture.hpp"
+#include "oaknut/call_site_table.hpp"
+#include "oaknut/oaknut.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+#ifdef ON_ARM64
+
+#    include "oaknut/dual_code_block.hpp"
+
+TEST_CASE("CallSiteTable (lazy binding)")
+{
+    DualCodeBlock mem{4096};
+    CodeGenerator code{mem.wptr(), mem.xptr()};
+    CodeGenerator callee_code{mem.wptr() + 512, mem.xptr() + 512};
+
+    int compile_count = 0;
+    CallSiteTable<DualCodeBlock> table{mem, [&](std::uint64_t key) -> const void* {
+                                           compile_count++;
+                                           const auto target = callee_code.xptr<const void*>();
+                                           callee_code.ADD(W0, W0, static_cast<std::uint32_t>(key));
+                                           callee_code.RET();
+                                           mem.invalidate_all();
+                                           return target;
+                                       }};
+
+    table.emit_resolver(code);
+    auto f = code.xptr<int (*)(int)>();
+    code.STP(X29, X30, SP, PRE_INDEXED, -16);
+    code.MOV(X29, SP);
+    const std::size_t site = table.emit_call(code, 5);
+    code.LDP(X29, X30, SP, POST_INDEXED, 16);
+    code.RET();
+    table.emit_veneers(code);
+    mem.invalidate_all();
+
+    REQUIRE(f(1) == 6);
+    REQUIRE(f(2) == 7);
+    REQUIRE(compile_count == 1);
+    REQUIRE(table.target(site) != nullptr);
+
+    table.unlink(table.target(site));
+    REQUIRE(f(3) == 8);
+    REQUIRE(compile_count == 2);
+}
+
+#endif
+
+namespace {
+
+// Applies patches directly, so that the words written by CallSiteTable can be inspected on any host.
+struct DirectPatchBlock {
+    void patch(std::uint32_t* mem, std::uint32_t instruction)
+    {
+        *mem = instruction;
+    }
+
+    void patch(std::span<const PatchSite> sites)
+    {
+        for (const PatchSite& site : sites)
+            *site.ptr = site.instruction;
+    }
+
+    void patch_literal(std::uint64_t* mem, std::uint64_t value)
+    {
+        *mem = value;
+    }
+};
+
+const std::uint32_t* branch_target(const std::uint32_t* at)
+{
+    return at + (static_cast<std::int32_t>(*at << 6) >> 6);
+}
+
+}  // namespace
+
+TEST_CASE("CallSiteTable")
+{
+    std::vector<std::uint32_t> mem(1024);
+    CodeGenerator code{mem.data()};
+    DirectPatchBlock block;
+    CallSiteTable<DirectPatchBlock> table{block, [](std::uint64_t) -> const void* { return nullptr; }};
+
+    std::uint32_t* const call = mem.data();
+    REQUIRE(table.emit_call(code, 10) == 0);
+    std::uint32_t* const jump = code.xptr<std::uint32_t*>();
+    REQUIRE(table.emit_jump(code, 20) == 1);
+    code.RET();
+    REQUIRE_THROWS_AS(table.emit_veneers(code), OaknutException);
+
+    table.emit_resolver(code);
+    table.emit_veneers(code);
+    REQUIRE(table.size() == 2);
+    REQUIRE(table.key(1) == 20);
+
+    const std::uint32_t* const call_veneer = branch_target(call);
+    const std::uint32_t* const jump_veneer = branch_target(jump);
+    REQUIRE((*call >> 26) == 0b100101);  // BL
+    REQUIRE((*jump >> 26) == 0b000101);  // B
+    REQUIRE(call_veneer[0] == 0x10000091);  // ADR X17, #16
+    REQUIRE(call_veneer[1] == 0xf9400230);  // LDR X16, [X17]
+    REQUIRE(call_veneer[2] == 0xd61f0200);  // BR X16
+    const auto* const call_slot = reinterpret_cast<const std::uint64_t*>(call_veneer + 4);
+    const auto* const jump_slot = reinterpret_cast<const std::uint64_t*>(jump_veneer + 4);
+    const std::uint64_t resolver = call_slot[0];
+    REQUIRE(resolver == reinterpret_cast<std::uintptr_t>(call + 3));
+    REQUIRE(call_slot[1] == 0);
+    REQUIRE(jump_slot[1] == 1);
+
+    const std::uint32_t call_to_veneer = *call, jump_to_veneer = *jump;
+    const void* const near_target = mem.data() + 1000;
+    const void* const far_target = reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(mem.data()) + (std::uintptr_t{1} << 30));
+
+    table.link(0, near_target);
+    table.link(1, near_target);
+    REQUIRE(*call == encode_bl(call, near_target));
+    REQUIRE(*jump == encode_b(jump, near_target));
+    REQUIRE(call_slot[0] == reinterpret_cast<std::uintptr_t>(near_target));
+
+    table.link(1, far_target);
+    REQUIRE(*jump == jump_to_veneer);
+    REQUIRE(jump_slot[0] == reinterpret_cast<std::uintptr_t>(far_target));
+    REQUIRE(table.target(1) == far_target);
+
+    table.unlink(near_target);
+    REQUIRE(*call == call_to_veneer);
+    REQUIRE(call_slot[0] == resolver);
+    REQUIRE(table.target(0) == nullptr);
+    REQUIRE(table.target(1) == far_target);
+
+    table.unlink(far_target);
+    REQUIRE(jump_slot[0] == resolver);
+}
+
+TEST_CASE("CallSiteTable (site at an island)")
+{
+    // The literal pool is due 0xFFFE0 bytes after the load; the site is placed at each position around it.
+    for (std::ptrdiff_t distance = 0xFFFD0; distance < 0xFFFF0; distance += 4) {
+        std::vector<std::uint32_t> mem(0x48000);
+        CodeGenerator code{mem.data()};
+        DirectPatchBlock block;
+        CallSiteTable<DirectPatchBlock> table{block, [](std::uint64_t) -> const void* { return nullptr; }};
+
+        table.emit_resolver(code);
+        const std::ptrdiff_t load = code.offset();
+        code.LDR(X0, code.literal64(0x123456789abcdef0));
+        while (code.offset() < load + distance)
+            code.NOP();
+        table.emit_call(code, 10);
+        std::uint32_t* const call = code.xptr<std::uint32_t*>() - 1;
+        code.RET();
+        table.emit_veneers(code);
+
+        const void* const target = mem.data() + 0x40000;
+        table.link(0, target);
+        REQUIRE(*call == encode_bl(call, target));
+    }
+}
+
+TEST_CASE("CallSiteTable (veneers across an island)")
+{
+    // The island for the TBZ is due at 0x7FE0; the veneer is placed at each position around it.
+    for (std::ptrdiff_t start = 0x7FA0; start < 0x8000; start += 4) {
+        std::vector<std::uint32_t> mem(0x4000);
+        CodeGenerator code{mem.data()};
+        code.set_branch_relaxation(true);
+        DirectPatchBlock block;
+        CallSiteTable<DirectPatchBlock> table{block, [](std::uint64_t) -> const void* { return nullptr; }};
+
+        Label later;
+        code.TBZ(X0, 3, later);
+        std::uint32_t* const call = code.xptr<std::uint32_t*>();
+        table.emit_call(code, 10);
+        code.RET();
+        table.emit_resolver(code);
+        while (code.offset() < start)
+            code.NOP();
+        table.emit_veneers(code);
+        code.l(later);
+
+        const std::uint32_t* const veneer = branch_target(call);
+        REQUIRE(veneer[0] == 0x10000091);  // ADR X17, #16
+        const auto* const slot = reinterpret_cast<const std::uint64_t*>(veneer + 4);
+        REQUIRE(slot[1] == 0);
+
+        table.link(0, mem.data() + 0x3F00);
+        REQUIRE(slot[0] == reinterpret_cast<std::uintptr_t>(mem.data() + 0x3F00));
+    }
+}
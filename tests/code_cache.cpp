@@ -0,0 +1,341 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "architecture.hpp"
+#include "oaknut/code_cache.hpp"
+#include "oaknut/code_reclaimer.hpp"
+#include "oaknut/code_space.hpp"
+#include "oaknut/oaknut.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+#ifdef ON_ARM64
+
+#    include "oaknut/code_block.hpp"
+#    include "oaknut/dual_code_block.hpp"
+
+TEST_CASE("CodeCache (execution)")
+{
+    CodeCache<CodeBlock> cache{64 * 1024};
+
+    std::vector<CodeHandle> handles;
+    cache.unprotect();
+    for (std::uint32_t i = 0; i < 100; i++) {
+        CodeHandle handle = cache.allocate(256);
+        CodeGenerator code{handle.wptr, handle.xptr};
+        code.MOV(W0, i);
+        code.RET();
+        cache.shrink(handle, code.offset());
+        handles.push_back(handle);
+    }
+    cache.protect();
+    cache.commit();
+
+    for (std::uint32_t i = 0; i < 100; i++)
+        REQUIRE(reinterpret_cast<std::uint32_t (*)()>(handles[i].xptr)() == i);
+}
+
+TEST_CASE("ConcurrentCodeSpace (execution)")
+{
+    DualCodeBlock block{4 * 1024 * 1024};
+    ConcurrentCodeSpace<DualCodeBlock> space{block};
+
+    constexpr std::uint32_t thread_count = 4, function_count = 500;
+    std::vector<std::thread> threads;
+    std::atomic<std::uint32_t> failures = 0;
+    for (std::uint32_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t] {
+            CodeSpaceArena<DualCodeBlock> arena{space, 16 * 1024};
+            std::vector<CodeHandle> handles;
+            for (std::uint32_t i = 0; i < function_count; i++) {
+                CodeHandle handle = arena.allocate(256);
+                CodeGenerator code{handle.wptr, handle.xptr};
+                code.MOV(W0, t << 16 | i);
+                code.RET();
+                arena.shrink(handle, code.offset());
+                handles.push_back(handle);
+            }
+            arena.commit();
+
+            for (std::uint32_t i = 0; i < function_count; i++) {
+                if (reinterpret_cast<std::uint32_t (*)()>(handles[i].xptr)() != (t << 16 | i))
+                    failures++;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    REQUIRE(failures == 0);
+}
+
+#endif
+
+namespace {
+
+// Stands in for CodeBlock on any host; its memory is only written, never executed.
+struct HeapCodeBlock {
+    HeapCodeBlock(std::size_t size_, const CodeBlockOptions& = {})
+        : memory(std::make_unique<std::uint32_t[]>(size_ / sizeof(std::uint32_t))), size_bytes(size_)
+    {}
+
+    std::size_t size() const
+    {
+        return size_bytes;
+    }
+
+    std::uint32_t* wptr() const
+    {
+        return memory.get();
+    }
+
+    std::uint32_t* xptr() const
+    {
+        return memory.get();
+    }
+
+    void invalidate(const DirtyRanges& ranges)
+    {
+        invalidated.assign(ranges.ranges().begin(), ranges.ranges().end());
+    }
+
+    std::unique_ptr<std::uint32_t[]> memory;
+    std::size_t size_bytes;
+    static inline std::vector<DirtyRange> invalidated;
+};
+
+}  // namespace
+
+TEST_CASE("CodeCache")
+{
+    CodeCache<HeapCodeBlock> cache{64 * 1024, 2};
+
+    const CodeHandle a = cache.allocate(100);
+    const CodeHandle b = cache.allocate(64);
+    REQUIRE(a.size == 128);
+    REQUIRE(b.xptr == a.xptr + 32);
+    REQUIRE(cache.stats().committed == 64 * 1024);
+    REQUIRE(cache.stats().used == 192);
+
+    // Freed allocations are reused by allocations of the same size class
+    cache.free(a);
+    REQUIRE(cache.stats().fragmented == 128);
+    REQUIRE(cache.allocate(128).xptr == a.xptr);
+    REQUIRE(cache.stats().fragmented == 0);
+
+    // Large free ranges are split
+    CodeHandle c = cache.allocate(8192);
+    cache.shrink(c, 100);
+    REQUIRE(c.size == 128);
+    const CodeHandle d = cache.allocate(5000);
+    REQUIRE(d.xptr == c.xptr + 32);
+    REQUIRE(cache.stats().fragmented == 8192 - 128 - 5056);
+
+    // The tail of an exhausted region is freed when the next region is added
+    const CodeHandle e = cache.allocate(60 * 1024);
+    REQUIRE(cache.stats().committed == 128 * 1024);
+    REQUIRE(cache.stats().used == 128 + 64 + 128 + 5056 + 60 * 1024);
+    REQUIRE(cache.stats().fragmented == (8192 - 128 - 5056) + (64 * 1024 - 128 - 64 - 8192));
+    REQUIRE_THROWS_AS(cache.allocate(60 * 1024), OaknutException);
+    REQUIRE_THROWS_AS(cache.allocate(128 * 1024), OaknutException);
+    cache.free(e);
+    REQUIRE(cache.allocate(60 * 1024).xptr == e.xptr);
+}
+
+TEST_CASE("CodeCache (shrink)")
+{
+    CodeCache<HeapCodeBlock> cache{1000};
+    REQUIRE(cache.region_size() == detail::allocation_size(1000, {}));
+    REQUIRE(cache.allocate(cache.region_size()));
+
+    CodeCache<HeapCodeBlock> other{64 * 1024};
+    CodeHandle a = other.allocate(256);
+    other.shrink(a, 0);
+    REQUIRE(a.size == CodeCache<HeapCodeBlock>::granule);
+    REQUIRE(other.stats().used == 64);
+    REQUIRE(other.stats().fragmented == 192);
+    other.free(a);
+    REQUIRE(other.stats().used == 0);
+    REQUIRE(other.allocate(64).xptr == a.xptr);
+}
+
+TEST_CASE("CodeCache (commit)")
+{
+    CodeCache<HeapCodeBlock> cache{64 * 1024};
+    const CodeHandle a = cache.allocate(64);
+    cache.allocate(128);
+    cache.allocate(4096 + 64);
+    cache.allocate(64);
+    cache.free(a);
+    cache.allocate(64);  // reuses a
+
+    HeapCodeBlock::invalidated.clear();
+    cache.commit();
+    const auto begin = reinterpret_cast<std::uintptr_t>(a.xptr);
+    REQUIRE(HeapCodeBlock::invalidated == std::vector<DirtyRange>{{begin, begin + 64 + 128 + 4096 + 64 + 64}});
+
+    HeapCodeBlock::invalidated.clear();
+    cache.commit();
+    REQUIRE(HeapCodeBlock::invalidated.empty());
+}
+
+TEST_CASE("ConcurrentCodeSpace")
+{
+    HeapCodeBlock block{1024 * 1024};
+    ConcurrentCodeSpace<HeapCodeBlock> space{block};
+
+    // A tail is reclaimed only if nothing was reserved after it
+    const CodeHandle a = space.reserve(1000);
+    const CodeHandle b = space.reserve(1000);
+    space.release_tail(a, 100);
+    REQUIRE(space.wasted() == 1024 - 128);
+    space.release_tail(b, 100);
+    REQUIRE(space.used() == 1024 + 128);
+    REQUIRE_THROWS_AS(space.reserve(1024 * 1024), OaknutException);
+}
+
+TEST_CASE("CodeSpaceArena")
+{
+    HeapCodeBlock block{1024 * 1024};
+    ConcurrentCodeSpace<HeapCodeBlock> space{block};
+
+    {
+        // Each chunk's tail is returned before the next chunk is reserved
+        CodeSpaceArena<HeapCodeBlock> arena{space, 4096};
+        CodeHandle a = arena.allocate(1000);
+        arena.shrink(a, 100);
+        const CodeHandle b = arena.allocate(4000);
+        REQUIRE(b.xptr == a.xptr + 32);
+        const CodeHandle c = arena.allocate(100);
+        REQUIRE(c.xptr == b.xptr + 4032 / 4);
+        REQUIRE(space.used() == 128 + 4032 + 4096);
+
+        // A chunk that cannot be reserved leaves the space as it was
+        REQUIRE_THROWS_AS(arena.allocate(1024 * 1024), OaknutException);
+        REQUIRE(arena.allocate(64).xptr == c.xptr + 128 / 4);
+    }
+    REQUIRE(space.used() == 128 + 4032 + 128 + 64);
+
+    space.reserve(64);
+    REQUIRE(space.wasted() == 0);
+}
+
+TEST_CASE("ConcurrentCodeSpace (threads)")
+{
+    HeapCodeBlock block{16 * 1024 * 1024};
+    ConcurrentCodeSpace<HeapCodeBlock> space{block};
+
+    constexpr std::uint32_t thread_count = 8, function_count = 2000;
+    std::vector<std::vector<CodeHandle>> functions(thread_count);
+    std::vector<std::thread> threads;
+    for (std::uint32_t t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t] {
+            CodeSpaceArena<HeapCodeBlock> arena{space, 16 * 1024};
+            for (std::uint32_t i = 0; i < function_count; i++) {
+                CodeHandle handle = arena.allocate(512);
+                CodeGenerator code{handle.wptr, handle.xptr};
+                const std::uint32_t length = 1 + (i * 7 + t) % 100;
+                for (std::uint32_t j = 0; j < length; j++)
+                    code.dw(t << 16 | i);
+                arena.shrink(handle, code.offset());
+                functions[t].push_back(handle);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::size_t total = 0;
+    for (std::uint32_t t = 0; t < thread_count; t++) {
+        for (std::uint32_t i = 0; i < function_count; i++) {
+            const CodeHandle& handle = functions[t][i];
+            const std::uint32_t length = 1 + (i * 7 + t) % 100;
+            REQUIRE(handle.size >= length * sizeof(std::uint32_t));
+            REQUIRE(std::all_of(handle.wptr, handle.wptr + length, [&](std::uint32_t word) { return word == (t << 16 | i); }));
+            total += handle.size;
+        }
+    }
+    REQUIRE(space.used() - space.wasted() == total);
+}
+
+TEST_CASE("CodeReclaimer")
+{
+    CodeCache<HeapCodeBlock> cache{64 * 1024};
+    CodeReclaimer<CodeCache<HeapCodeBlock>> reclaimer{cache, 2};
+
+    const std::size_t t0 = reclaimer.register_thread();
+    const std::size_t t1 = reclaimer.register_thread();
+    REQUIRE_THROWS_AS(reclaimer.register_thread(), OaknutException);
+
+    const CodeHandle a = cache.allocate(256);
+    reclaimer.retire(a);
+    REQUIRE(reclaimer.pending() == 256);
+
+    // Freed only once every thread has passed a safe point
+    REQUIRE(reclaimer.reclaim() == 0);
+    reclaimer.quiescent(t0);
+    REQUIRE(reclaimer.reclaim() == 0);
+    reclaimer.quiescent(t1);
+    REQUIRE(reclaimer.reclaim() == 256);
+    REQUIRE(reclaimer.pending() == 0);
+    REQUIRE(cache.stats().used == 0);
+
+    // Freed memory is reused
+    const CodeHandle b = cache.allocate(256);
+    REQUIRE(b.xptr == a.xptr);
+
+    // Offline and unregistered threads do not hold up reclamation
+    reclaimer.retire(b);
+    reclaimer.offline(t0);
+    reclaimer.unregister_thread(t1);
+    REQUIRE(reclaimer.reclaim() == 256);
+
+    // A thread coming back online does not see code retired before
+    reclaimer.online(t0);
+    reclaimer.retire(cache.allocate(64));
+    REQUIRE(reclaimer.reclaim() == 0);
+    reclaimer.quiescent(t0);
+    REQUIRE(reclaimer.reclaim() == 64);
+}
+
+TEST_CASE("CodeReclaimer (threads)")
+{
+    CodeCache<HeapCodeBlock> cache{1024 * 1024};
+    CodeReclaimer<CodeCache<HeapCodeBlock>> reclaimer{cache};
+
+    std::atomic<bool> done = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            const std::size_t thread = reclaimer.register_thread();
+            while (!done)
+                reclaimer.quiescent(thread);
+            reclaimer.unregister_thread(thread);
+        });
+    }
+
+    // The footprint stays bounded while functions are repeatedly replaced
+    for (int i = 0; i < 10000; i++) {
+        reclaimer.retire(cache.allocate(1024));
+        while (reclaimer.pending() > 512 * 1024)
+            reclaimer.reclaim();
+    }
+    done = true;
+    for (std::thread& thread : threads)
+        thread.join();
+
+    reclaimer.reclaim();
+    REQUIRE(reclaimer.pending() == 0);
+    REQUIRE(cache.stats().used == 0);
+}
@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "architecture.hpp"
+#include "oaknut/impl/relocation.hpp"
+#include "oaknut/linker.hpp"
+#include "oaknut/oaknut.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+#ifdef ON_ARM64
+
+#    include "oaknut/code_block.hpp"
+#    include "oaknut/dual_code_block.hpp"
+
+TEST_CASE("Relocation records (execution)")
+{
+    DualCodeBlock mem{4096};
+
+    CodeGenerator helper{mem.wptr(), mem.xptr()};
+    const auto increment = helper.xptr<const void*>();
+    helper.ADD(X0, X0, 1);
+    helper.RET();
+
+    std::vector<std::uint32_t> buffer;
+    VectorCodeGenerator code{buffer};
+    code.set_relocation_recording(true);
+    Label table, done;
+    code.STP(X29, X30, SP, PRE_INDEXED, -16);
+    code.MOV(X0, 41);
+    code.BL(increment);
+    code.ADR(X1, table);
+    code.LDR(X1, X1);
+    code.BR(X1);
+    code.align(8);
+    code.l(table);
+    code.dx(done);
+    code.l(done);
+    code.LDP(X29, X30, SP, POST_INDEXED, 16);
+    code.RET();
+
+    for (const std::size_t offset : {256, 1024}) {
+        std::uint32_t* const wptr = mem.wptr() + offset / sizeof(std::uint32_t);
+        std::uint32_t* const xptr = mem.xptr() + offset / sizeof(std::uint32_t);
+        std::copy(buffer.begin(), buffer.end(), wptr);
+        relocate(std::span{wptr, buffer.size()}, code.relocations(), reinterpret_cast<std::uintptr_t>(xptr));
+        mem.invalidate(xptr, buffer.size() * sizeof(std::uint32_t));
+        REQUIRE(reinterpret_cast<std::uint64_t (*)()>(xptr)() == 42);
+    }
+}
+
+TEST_CASE("Linker (execution)")
+{
+    const auto make_function = [](std::uint64_t symbol, double weight, std::size_t padding, auto&& body) {
+        LinkerFunction function{.symbol = symbol, .weight = weight};
+        VectorCodeGenerator code{function.code};
+        code.set_relocation_recording(true);
+        body(code, function.references);
+        for (std::size_t i = 0; i < padding; i++)
+            code.BRK(0);
+        function.relocations.assign(code.relocations().begin(), code.relocations().end());
+        return function;
+    };
+
+    // With a short branch range, the call from f to g goes through a thunk
+    for (const std::size_t branch_range : {near_branch_range, std::size_t{4096}}) {
+        Linker linker{LinkerOptions{.branch_range = branch_range}};
+        linker.add(make_function(1, 10, 0, [](VectorCodeGenerator& code, std::vector<SymbolReference>& references) {
+            code.STP(X29, X30, SP, PRE_INDEXED, -16);
+            Linker::emit_call(code, references, 2);
+            code.ADD(X0, X0, 1);
+            code.LDP(X29, X30, SP, POST_INDEXED, 16);
+            code.RET();
+        }));
+        linker.add(make_function(3, 0, 2048, [](VectorCodeGenerator& code, std::vector<SymbolReference>&) {
+            code.RET();
+        }));
+        linker.add(make_function(2, 0, 0, [](VectorCodeGenerator& code, std::vector<SymbolReference>&) {
+            code.LSL(X0, X0, 1);
+            code.RET();
+        }));
+
+        CodeBlock mem{linker.layout()};
+        mem.unprotect();
+        linker.link(mem.ptr(), mem.ptr());
+        mem.protect();
+        mem.invalidate_all();
+
+        REQUIRE(linker.thunk_count() == (branch_range == 4096 ? 1 : 0));
+        const auto f = reinterpret_cast<std::uint64_t (*)(std::uint64_t)>(mem.ptr() + linker.offset(1) / sizeof(std::uint32_t));
+        REQUIRE(f(20) == 41);
+    }
+}
+
+#endif
+
+TEST_CASE("Relocation records")
+{
+    const auto target = reinterpret_cast<const void*>(std::uintptr_t{0x10'0000'6000});
+    const auto emit = [&](auto& code) {
+        Label data, end;
+        code.B(target);
+        code.BL(target);
+        code.B(Cond::NE, target);
+        code.CBZ(X0, target);
+        code.TBZ(X0, 3, target);
+        code.LDR(X1, target);
+        code.ADR(X2, target);
+        code.ADRL(X3, target);
+        code.ADRP(X4, data);
+        code.B(end);
+        code.align(16);
+        code.l(data);
+        code.dx(data);
+        code.dx(end);
+        code.l(end);
+        code.RET();
+    };
+
+    std::vector<std::uint32_t> relocatable;
+    VectorCodeGenerator code{relocatable};
+    code.set_relocation_recording(true);
+    emit(code);
+    REQUIRE(code.relocations().size() == 11);
+
+    const auto relocated_at = [&](std::uintptr_t xaddr) {
+        std::vector<std::uint32_t> relocated = relocatable;
+        relocate(relocated, code.relocations(), xaddr);
+        return relocated;
+    };
+    const auto emitted_at = [&](std::uintptr_t xaddr) {
+        std::vector<std::uint32_t> expected;
+        VectorCodeGenerator reference{expected, reinterpret_cast<std::uint32_t*>(xaddr)};
+        emit(reference);
+        return expected;
+    };
+
+    // Relocated code matches code emitted in place
+    REQUIRE(relocated_at(0x10'0000'0000) == emitted_at(0x10'0000'0000));
+    REQUIRE(relocated_at(0x10'0000'4000) == emitted_at(0x10'0000'4000));
+
+    // ADRP to a label crosses a page boundary that it would not if the code were page-aligned
+    std::vector<std::uint32_t> expected = emitted_at(0x10'0000'0fd0);
+    expected[9] |= 1 << 29;
+    REQUIRE(relocated_at(0x10'0000'0fd0) == expected);
+
+    REQUIRE_THROWS_AS(relocated_at(0x20'0000'0000), OaknutException);
+}
+
+namespace {
+
+const std::uint32_t* branch_target(const std::uint32_t* at)
+{
+    return at + (static_cast<std::int32_t>(*at << 6) >> 6);
+}
+
+LinkerFunction make_linker_function(std::uint64_t symbol, double weight, std::size_t size, const std::vector<std::uint64_t>& callees)
+{
+    LinkerFunction function{.symbol = symbol, .weight = weight};
+    VectorCodeGenerator code{function.code};
+    code.set_relocation_recording(true);
+    for (const std::uint64_t callee : callees)
+        Linker::emit_call(code, function.references, callee);
+    while (code.offset() < static_cast<std::ptrdiff_t>(size))
+        code.NOP();
+    code.RET();
+    function.relocations.assign(code.relocations().begin(), code.relocations().end());
+    return function;
+}
+
+}  // namespace
+
+TEST_CASE("Linker (ordering)")
+{
+    Linker linker;
+    linker.add(make_linker_function(1, 1, 64, {3}));
+    linker.add(make_linker_function(2, 10, 64, {1}));
+    linker.add(make_linker_function(3, 5, 64, {}));
+    linker.add(make_linker_function(4, 0, 64, {}));
+    linker.add(make_linker_function(5, 0.5, 64, {4}));
+
+    // Hot functions are followed by their hot callees, then cold functions are placed in order
+    REQUIRE(linker.offset(2) == 0);
+    REQUIRE(linker.offset(1) == 80);
+    REQUIRE(linker.offset(3) == 160);
+    REQUIRE(linker.offset(5) == 240);
+    REQUIRE(linker.offset(4) == 320);
+    REQUIRE(linker.layout() == 388);
+    REQUIRE(linker.thunk_count() == 0);
+
+    std::vector<std::uint32_t> mem(linker.layout() / sizeof(std::uint32_t));
+    linker.link(mem.data(), mem.data());
+    REQUIRE(branch_target(&mem[80 / 4]) == &mem[160 / 4]);
+    REQUIRE(branch_target(&mem[240 / 4]) == &mem[320 / 4]);
+    REQUIRE((mem[0] & 0xFC00'0000) == 0x9400'0000);
+
+    REQUIRE_THROWS_AS(linker.add(make_linker_function(3, 0, 0, {})), OaknutException);
+    Linker undefined;
+    undefined.add(make_linker_function(1, 0, 0, {2}));
+    REQUIRE_THROWS_AS(undefined.layout(), OaknutException);
+}
+
+TEST_CASE("Linker (thunks)")
+{
+    Linker linker{LinkerOptions{.branch_range = 4096}};
+    linker.add(make_linker_function(1, 0, 16, {4, 2}));
+    linker.add(make_linker_function(2, 0, 16, {4}));
+    linker.add(make_linker_function(3, 0, 8192, {}));
+    linker.add(make_linker_function(4, 0, 16, {1}));
+
+    std::vector<std::uint32_t> mem(linker.layout() / sizeof(std::uint32_t));
+    linker.link(mem.data(), mem.data());
+
+    // Functions 1 and 2 share one thunk to function 4, and function 4 reaches function 1 through another
+    REQUIRE(linker.thunk_count() == 2);
+    const std::uint32_t* const f1 = &mem[linker.offset(1) / 4];
+    const std::uint32_t* const f2 = &mem[linker.offset(2) / 4];
+    const std::uint32_t* const f4 = &mem[linker.offset(4) / 4];
+    REQUIRE(branch_target(f1 + 1) == f2);
+    REQUIRE(branch_target(f1) == branch_target(f2));
+
+    const auto thunk_to = [&](const std::uint32_t* thunk, const std::uint32_t* target) {
+        std::array<std::uint32_t, 3> expected;
+        CodeGenerator code{expected.data(), const_cast<std::uint32_t*>(thunk)};
+        code.ADRL(X16, target);
+        code.BR(X16);
+        return std::equal(expected.begin(), expected.end(), thunk);
+    };
+    REQUIRE(thunk_to(branch_target(f1), f4));
+    REQUIRE(thunk_to(branch_target(f4), f1));
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+// Built with exceptions disabled to check the emitter does not depend on them.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "oaknut/code_block.hpp"
+#include "oaknut/code_cache.hpp"
+#include "oaknut/dual_code_block.hpp"
+#include "oaknut/oaknut.hpp"
+
+#if !defined(OAKNUT_NO_EXCEPTIONS)
+#    error "this file must be compiled with exceptions disabled"
+#endif
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            std::fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                       \
+        }                                                                   \
+    } while (0)
+
+int main()
+{
+    std::uint32_t mem[16];
+    CodeGenerator code{mem};
+
+    CHECK(get_error_mode() == ErrorMode::Defer);
+
+    code.MOV(W0, 42);
+    code.RET();
+    CHECK(!deferred_error());
+    CHECK(mem[0] == 0x52800540);
+    CHECK(mem[1] == 0xd65f03c0);
+
+    code.AND(X0, X1, 0);
+    code.B(EQ, 3);
+    CHECK(deferred_error() == ExceptionType::InvalidBitImm64);
+    CHECK(code.offset() == 16);
+
+    clear_deferred_error();
+    code.align(3);
+    CHECK(deferred_error() == ExceptionType::InvalidAlignment);
+
+    // More address space than any process has
+    constexpr std::size_t huge = std::size_t{1} << 62;
+
+    clear_deferred_error();
+    CodeBlock block{huge};
+    CHECK(deferred_error() == ExceptionType::CodeBlockAllocationFailed);
+    CHECK(block.ptr() == nullptr);
+    CHECK(block.size() == 0);
+
+    clear_deferred_error();
+    DualCodeBlock dual_block{huge};
+    CHECK(deferred_error() == ExceptionType::CodeBlockAllocationFailed);
+    CHECK(dual_block.wptr() == nullptr);
+    CHECK(dual_block.xptr() == nullptr);
+    CHECK(dual_block.size() == 0);
+
+    // A region that fails to map is not added
+    clear_deferred_error();
+    CodeCache<CodeBlock> cache{huge, 2};
+    CHECK(!cache.allocate(64));
+    CHECK(deferred_error() == ExceptionType::CodeBlockAllocationFailed);
+    CHECK(!cache.allocate(64));
+    CHECK(cache.stats().committed == 0);
+    CHECK(cache.stats().used == 0);
+
+    return 0;
+}
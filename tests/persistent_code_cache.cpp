@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "architecture.hpp"
+#include "oaknut/oaknut.hpp"
+#include "oaknut/persistent_code_cache.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+#ifdef ON_ARM64
+
+#    include "oaknut/code_block.hpp"
+
+namespace {
+
+int host_function(int x)
+{
+    return x * 2;
+}
+
+}  // namespace
+
+TEST_CASE("PersistentCodeCache (execution)")
+{
+    const auto host_base = reinterpret_cast<std::uintptr_t>(&host_function);
+    const std::string path = (std::filesystem::temp_directory_path() / "oaknut-persistent-code-cache-execution.bin").string();
+
+    {
+        std::vector<std::uint32_t> buffer;
+        VectorCodeGenerator code{buffer};
+        code.set_relocation_recording(true);
+        code.STP(X29, X30, SP, PRE_INDEXED, -16);
+        code.MOVP2R(X16, reinterpret_cast<const void*>(&host_function));
+        code.BLR(X16);
+        code.ADD(W0, W0, 1);
+        code.LDP(X29, X30, SP, POST_INDEXED, 16);
+        code.RET();
+
+        PersistentCodeCacheWriter writer{host_base};
+        writer.add(42, CpuFeatures{}, buffer, code.relocations());
+        REQUIRE(writer.write(path.c_str()));
+    }
+
+    PersistentCodeCache cache{path.c_str(), host_base};
+    const std::optional<PersistentCode> entry = cache.find(42, CpuFeatures{});
+    REQUIRE(entry);
+
+    CodeBlock mem{4096};
+    mem.unprotect();
+    entry->load(mem.ptr(), mem.ptr());
+    mem.protect();
+    mem.invalidate(mem.ptr(), entry->size());
+    REQUIRE(reinterpret_cast<int (*)(int)>(mem.ptr())(20) == 41);
+
+    std::filesystem::remove(path);
+}
+
+#endif
+
+TEST_CASE("PersistentCodeCache")
+{
+    constexpr std::uintptr_t old_base = 0x10'0000'0000, new_base = 0x20'0000'0000;
+
+    std::vector<std::uint32_t> buffer;
+    VectorCodeGenerator code{buffer};
+    code.set_relocation_recording(true);
+    Label data;
+    code.MOVP2R(X0, reinterpret_cast<const void*>(old_base + 0x1234'5678'9abc));
+    code.BL(reinterpret_cast<const void*>(old_base + 0x2000));
+    code.RET();
+    code.align(8);
+    code.l(data);
+    code.dx(data);
+    REQUIRE(code.relocations().size() == 3);
+
+    const CpuFeatures features{CpuFeature::FP, CpuFeature::ASIMD};
+    const CpuFeatures other_features{CpuFeature::FP, CpuFeature::ASIMD, CpuFeature::LSE};
+
+    PersistentCodeCacheWriter writer{old_base};
+    writer.add(2, features, buffer, code.relocations());
+    writer.add(1, other_features, std::span{buffer}.first(1), {});
+    const std::vector<std::byte> serialized = writer.serialize();
+
+    PersistentCodeCache cache{serialized, new_base};
+    REQUIRE(cache.valid());
+    REQUIRE(cache.size() == 2);
+
+    // Absolute targets follow the host base
+    const std::optional<PersistentCode> entry = cache.find(2, features);
+    REQUIRE(entry);
+    REQUIRE(entry->size() == buffer.size() * sizeof(std::uint32_t));
+    std::vector<std::uint32_t> loaded(buffer.size());
+    entry->load(loaded.data(), reinterpret_cast<std::uint32_t*>(new_base));
+
+    std::vector<std::uint32_t> expected;
+    VectorCodeGenerator reference{expected, reinterpret_cast<std::uint32_t*>(new_base)};
+    reference.MOVZ(X0, MovImm16{0x9abc, MovImm16Shift::SHL_0});
+    reference.MOVK(X0, MovImm16{0x5678, MovImm16Shift::SHL_16});
+    reference.MOVK(X0, MovImm16{0x1254, MovImm16Shift::SHL_32});
+    reference.MOVK(X0, MovImm16{0x0000, MovImm16Shift::SHL_48});
+    reference.BL(reinterpret_cast<const void*>(new_base + 0x2000));
+    reference.RET();
+    reference.align(8);
+    reference.dx(new_base + 24);
+    REQUIRE(loaded == expected);
+
+    // Entries are only found for the exact features they were compiled for
+    REQUIRE(!cache.find(2, other_features));
+    REQUIRE(!cache.find(3, features));
+    REQUIRE(cache.find(1, other_features));
+
+    // Invalid files and malformed entries are rejected
+    std::vector<std::byte> corrupted = serialized;
+    corrupted[8] ^= std::byte{1};
+    REQUIRE(!PersistentCodeCache{corrupted}.valid());
+    REQUIRE(!PersistentCodeCache{std::span{serialized}.first(16)}.valid());
+
+    corrupted = serialized;
+    detail::PersistentEntry stored;
+    std::memcpy(&stored, corrupted.data() + 32 + sizeof(stored), sizeof(stored));
+    const std::int64_t bad_offset = 1 << 20;
+    std::memcpy(corrupted.data() + stored.relocation_offset, &bad_offset, sizeof(bad_offset));
+    REQUIRE(PersistentCodeCache{corrupted}.valid());
+    REQUIRE(!PersistentCodeCache{corrupted}.find(2, features));
+
+    // Files are mapped
+    const std::string path = (std::filesystem::temp_directory_path() / "oaknut-persistent-code-cache.bin").string();
+    REQUIRE(writer.write(path.c_str()));
+    REQUIRE(PersistentCodeCache{path.c_str(), new_base}.find(2, features));
+    std::filesystem::remove(path);
+    REQUIRE(!PersistentCodeCache{path.c_str()}.valid());
+}
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026 merryhime <https://mary.rs>
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "oaknut/oaknut.hpp"
+
+using namespace oaknut;
+using namespace oaknut::util;
+
+TEST_CASE("assemble")
+{
+    constexpr auto emit_stub = [](auto& code) {
+        Label done;
+        code.CBZ(X0, done);
+        code.ADD(X0, X1, X2, LSL, 3);
+        code.MOV(X3, 0x1234'5678'9abc'def0);
+        code.l(done);
+        code.LDR(X4, code.literal64(0x1122'3344'5566'7788));
+        code.RET();
+        code.flush_literals();
+    };
+
+    constexpr std::array<std::uint32_t, 10> stub = assemble<10>(emit_stub);
+    static_assert(stub[0] == 0xb40000c0);
+    static_assert(stub[7] == 0xd65f03c0);
+
+    std::vector<std::uint32_t> vec;
+    VectorCodeGenerator code{vec};
+    emit_stub(code);
+
+    REQUIRE(vec == std::vector<std::uint32_t>(stub.begin(), stub.end()));
+
+    ArrayCodeGenerator<2> array_code;
+    array_code.NOP();
+    array_code.NOP();
+    REQUIRE(array_code.size() == 2);
+    REQUIRE_THROWS_AS(array_code.NOP(), OaknutException);
+}
+
+TEST_CASE("Stencil")
+{
+    constexpr auto stencil = make_stencil<4>(
+        [](auto& code) {
+            Label placeholder = code.l();
+            code.ADD(X0, X0, 0);
+            code.LDR(X0, X0, 0);
+            code.CBZ(X0, placeholder);
+            code.B(placeholder);
+        },
+        StencilHole{0, stencil::Rd}, StencilHole{0, stencil::Rn}, StencilHole{0, stencil::Imm12},
+        StencilHole{1, stencil::Rt}, StencilHole{1, stencil::Rn}, StencilHole{2, stencil::Rt},
+        StencilHole{2, stencil::Branch19}, StencilHole{3, stencil::Branch26});
+
+    const auto emit_direct = [](auto& code, XReg a, XReg b, std::uint32_t imm, Label& back, Label& forward) {
+        code.ADD(a, b, imm);
+        code.LDR(b, a, 0);
+        code.CBZ(b, back);
+        code.B(forward);
+    };
+
+    std::vector<std::uint32_t> expected, actual;
+    VectorCodeGenerator direct{expected}, patched{actual};
+
+    for (int i = 0; i < 64; i++) {
+        const XReg a{i % 31}, b{(i * 7 + 3) % 31};
+        const std::uint32_t imm = static_cast<std::uint32_t>(i * 61) & 0xFFF;
+
+        Label back1 = direct.l(), forward1;
+        direct.NOP();
+        emit_direct(direct, a, b, imm, back1, forward1);
+        direct.l(forward1);
+
+        Label back2 = patched.l(), forward2;
+        patched.NOP();
+        patched.emit_stencil<stencil>({a, b, imm, b, a, b, back2, forward2});
+        patched.l(forward2);
+    }
+    REQUIRE(actual == expected);
+
+    Label label;
+    REQUIRE_THROWS_AS(patched.emit_stencil<stencil>({X0, X0, 0x1000u, X0, X0, X0, label, label}), OaknutException);
+    REQUIRE_THROWS_AS(patched.emit_stencil<stencil>({X0, X0, 0u, X0, X0, X0, 0u, label}), OaknutException);
+}